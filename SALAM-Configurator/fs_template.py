@@ -72,6 +72,16 @@ def addHWAccOptions(parser):
                       help="""Path to folders containing accelerator benchmarks""", default="")
     parser.add_argument("--accbench", action="store", type=str,
                       help="""Name of benchmark to accelerate""", default="")
+    parser.add_argument("--acc_eventqs", action="store", type=int,
+                      help="""Host threads to spread accelerators over, 0 keeps them on the main event queue""", default=0)
+    parser.add_argument("--acc_quantum", action="store", type=int,
+                      help="""Ticks between synchronizations of the accelerator event queues""", default=1000000)
+    parser.add_argument("--acc_functional", action="store", type=int,
+                      help="""Invocations each accelerator executes functionally before switching to timing, -1 stays functional until the workload issues m5 switchcpu""", default=0)
+    parser.add_argument("--acc_jit", action="store_true",
+                      help="""JIT-compile the pure dataflow of accelerator basic blocks instead of interpreting it""")
+    parser.add_argument("--acc_sampling", action="store", type=int,
+                      help="""Loop iterations per sampling period of the accelerators, 0 simulates every iteration in detail""", default=0)
 
 def cmd_line_template():
     if args.command_line and args.command_line_file:
@@ -373,6 +383,26 @@ if ObjectList.is_kvm_cpu(TestCPUClass) or \
     # Note: The simulator is quite picky about this number!
     root.sim_quantum = int(1e9) # 1 ms
 
+if args.acc_eventqs > 0:
+    # Accelerators on their own event queues synchronize every quantum. The
+    # bridges at the cluster xbars delay crossings by the same amount
+    root.sim_quantum = args.acc_quantum
+
+if args.acc_functional != 0:
+    for obj in test_sys.descendants():
+        if isinstance(obj, LLVMInterface):
+            obj.functional_invocations = args.acc_functional
+
+if args.acc_jit:
+    for obj in test_sys.descendants():
+        if isinstance(obj, LLVMInterface):
+            obj.jit_compute = True
+
+if args.acc_sampling > 0:
+    for obj in test_sys.descendants():
+        if isinstance(obj, LLVMInterface):
+            obj.sampling_period = args.acc_sampling
+
 if args.timesync:
     root.time_sync_enable = True
 
@@ -398,4 +428,18 @@ if buildEnv['TARGET_ISA'] == "arm" and not args.bare_metal \
             sys.generateDtb(sys.workload.dtb_filename)
 
 Simulation.setWorkCountOptions(test_sys, args)
-Simulation.run(args, root, test_sys, FutureClass)
+if args.acc_functional < 0:
+    # Accelerators fast forward functionally until the workload issues an
+    # m5 switchcpu, then continue in detailed timing
+    m5.instantiate()
+    exit_event = m5.simulate()
+    if exit_event.getCause() == "switchcpu":
+        print("Switching accelerators to timing @ tick %i" % m5.curTick())
+        for obj in test_sys.descendants():
+            if isinstance(obj, LLVMInterface):
+                obj.getCCObject().switchToTiming()
+        exit_event = m5.simulate()
+    print('Exiting @ tick %i because %s' %
+          (m5.curTick(), exit_event.getCause()))
+else:
+    Simulation.run(args, root, test_sys, FutureClass)
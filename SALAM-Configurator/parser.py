@@ -188,23 +188,27 @@ class Accelerator:
 
 		for i in self.localConnections:
 				if "LocalBus" in i:
-					lines.append("clstr." + self.name + ".local = clstr.local_bus.cpu_side_ports")
+					lines.append("clstr." + self.name + ".local = clstr._acc_local_port(options, clstr." + self.name + ")")
 				else:
 					lines.append("clstr." + self.name + ".local = clstr." + i.lower() + ".pio")
+					lines.append("clstr._tie_eventqs(clstr." + self.name + ", clstr." + i.lower() + ")")
 
 		# Assign PIO Masters
 		for i in self.pioMasters:
 			if "LocalBus" in i:
-				lines.append("clstr." + self.name + ".pio = clstr.local_bus.mem_side_ports")
+				lines.append("clstr." + self.name + ".pio = clstr._acc_pio_port(options, clstr." + self.name + ")")
 			else:
 				lines.append("clstr." + self.name + ".pio " +
 					"=" " clstr." + i + ".local")
+				lines.append("clstr._tie_eventqs(clstr." + self.name + ", clstr." + i + ")")
 		# Add StreamIn
 		for i in self.streamIn:
 			lines.append("clstr." + self.name + ".stream = clstr." + i.lower() + ".stream_in")
+			lines.append("clstr._tie_eventqs(clstr." + self.name + ", clstr." + i.lower() + ")")
 		# Add StreamOut
 		for i in self.streamOut:
 			lines.append("clstr." + self.name + ".stream = clstr." + i.lower() + ".stream_out")
+			lines.append("clstr._tie_eventqs(clstr." + self.name + ", clstr." + i.lower() + ")")
 
 		lines.append("clstr." + self.name + ".enable_debug_msgs = " + str(self.debug))
 		lines.append("")
@@ -314,6 +318,13 @@ class Variable:
 			self.resetOnRead = kwargs.get('ResetOnRead', True)
 			self.readOnInvalid = kwargs.get('ReadOnInvalid', False)
 			self.writeOnValid = kwargs.get('WriteOnValid', True)
+			self.readyGranularity = kwargs.get('ReadyGranularity', 1)
+			self.banks = kwargs.get('Banks', 1)
+			self.interleaving = kwargs.get('Interleaving', 'cyclic')
+			self.bankWordSize = kwargs.get('BankWordSize', 4)
+			self.bankMask = kwargs.get('BankMask', 0)
+			self.bankReadPorts = kwargs.get('BankReadPorts', 0)
+			self.bankWritePorts = kwargs.get('BankWritePorts', 0)
 			# Append the default connection here... probably need to be more elegant
 			self.connections.append(PortedConnection(self.accName, self.ports))
 			# Append other connections to the connections list
@@ -367,6 +378,7 @@ class Variable:
 			+ str(self.streamSize) + ", buffer_size = " + str(self.bufferSize) + ")")
 			lines.append("clstr." + self.inCon + ".stream = " + "clstr." + self.name.lower() + ".stream_in")
 			lines.append("clstr." + self.outCon + ".stream = " + "clstr." + self.name.lower() + ".stream_out")
+			lines.append("clstr._tie_eventqs(clstr." + self.name.lower() + ", clstr." + self.inCon + ", clstr." + self.outCon + ")")
 			lines.append("")
 		# Scratchpad Memory
 		elif self.type == 'SPM':
@@ -381,12 +393,21 @@ class Variable:
 			lines.append("clstr." + self.name.lower() + "." + "reset_on_scratchpad_read = " + str(self.resetOnRead))
 			lines.append("clstr." + self.name.lower() + "." + "read_on_invalid = " + str(self.readOnInvalid))
 			lines.append("clstr." + self.name.lower() + "." + "write_on_valid = " + str(self.writeOnValid))
-			lines.append("clstr." + self.name.lower() + "." + "port" + " = " + "clstr.local_bus.mem_side_ports")
+			lines.append("clstr." + self.name.lower() + "." + "ready_granularity = " + str(self.readyGranularity))
+			lines.append("clstr." + self.name.lower() + "." + "num_banks = " + str(self.banks))
+			lines.append("clstr." + self.name.lower() + "." + "interleaving = '" + str(self.interleaving) + "'")
+			lines.append("clstr." + self.name.lower() + "." + "bank_word_size = " + str(self.bankWordSize))
+			lines.append("clstr." + self.name.lower() + "." + "bank_mask = " + str(self.bankMask))
+			lines.append("clstr." + self.name.lower() + "." + "bank_read_ports = " + str(self.bankReadPorts))
+			lines.append("clstr." + self.name.lower() + "." + "bank_write_ports = " + str(self.bankWritePorts))
+			lines.append("clstr." + self.name.lower() + "." + "port" + " = " + "clstr._acc_pio_port(options, clstr."
+			+ self.accName.lower() + ", clstr." + self.name.lower() + ")")
 			for i in self.connections:
 				lines.append("")
 				lines.append("# Connecting " + self.name + " to " + i.conName)
 				lines.append("for i in range(" + str(i.numPorts) + "):")
 				lines.append("	clstr." + i.conName.lower() + ".spm = " + "clstr." + self.name.lower() + ".spm_ports")
+				lines.append("clstr._tie_eventqs(clstr." + i.conName.lower() + ", clstr." + self.name.lower() + ")")
 		# RegisterBank
 		elif self.type == 'RegisterBank':
 			lines.append("# " + self.name + " (Variable)")
@@ -394,17 +415,20 @@ class Variable:
 			lines.append("regRange = AddrRange(addr, addr + " + hex(self.size) + ")")
 			# When appending convert all connections to lowercase for standardization
 			lines.append("clstr." + self.name.lower() + " = RegisterBank(range = regRange)")
-			lines.append("clstr." + self.name.lower() + "." + "load_port" + " = " + "clstr.local_bus.mem_side_ports")
+			lines.append("clstr." + self.name.lower() + "." + "load_port" + " = " + "clstr._acc_pio_port(options, clstr."
+			+ self.accName.lower() + ", clstr." + self.name.lower() + ")")
 			for i in self.connections:
 				lines.append("")
 				lines.append("# Connecting " + self.name + " to " + i.conName)
 				lines.append("clstr." + i.conName.lower() + ".reg = " + "clstr." + self.name.lower() + ".reg_port")
+				lines.append("clstr._tie_eventqs(clstr." + i.conName.lower() + ", clstr." + self.name.lower() + ")")
 		# L1 Cache, need to add L2 still...
 		elif self.type == 'Cache':
 			lines.append("# " + self.name + " (Cache)")
 			lines.append("clstr." + self.name + " = L1Cache(size = '" + str(self.size) + "B')")
 			lines.append("clstr." + self.name + ".mem_side = clstr.coherency_bus.cpu_side_ports")
 			lines.append("clstr." + self.name + ".cpu_side = clstr." + self.accName + ".local")
+			lines.append("clstr._tie_eventqs(clstr." + self.accName + ", clstr." + self.name + ")")
 		else:
 			# Should never get here... but just in case throw an exception
 			exceptionString = ("The variable: " + self.name
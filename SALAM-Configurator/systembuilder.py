@@ -93,6 +93,12 @@ with open(CONFIG_Path + fileName + ".py", 'w') as f:
 	for i in clusters:
 		f.write("	system." + i.name.lower() + " = AccCluster()" + "\n")
 		f.write("	build" + i.name + "(args, system, system." + i.name.lower() + ")\n\n")
+	# Spread the accelerators of all clusters over the requested event queues
+	f.write("	if getattr(args, 'acc_eventqs', 0) > 0:\n")
+	f.write("		queue = 0\n")
+	for i in clusters:
+		f.write("		queue = system." + i.name.lower() + "._assign_eventqs(1, args.acc_eventqs, args.acc_quantum, queue)\n")
+	f.write("\n")
 begin = None
 end = None
 # Read in existing header
@@ -155,7 +161,7 @@ shutil.copyfile(M5_Path + "/SALAM-Configurator/fs_template.py", CONFIG_Path + "f
 f = open(CONFIG_Path + "fs_" + fileName + ".py", "r")
 fullSystem = f.readlines()
 fullSystem[65] = "import " + fileName
-fullSystem[229] = "        " + fileName + ".makeHWAcc(args, test_sys)\n"
+fullSystem[235] = "        " + fileName + ".makeHWAcc(args, test_sys)\n"
 f = open(CONFIG_Path + "fs_" + fileName + ".py", "w")
 f.writelines(fullSystem)
 # Warn if the size is greater than allowed
@@ -221,8 +221,8 @@ class FunctionalUnitGenerator():
             self.base_header_file.write("\t\tdouble _leakage_power;\n")
             self.base_header_file.write("\t\tdouble _area;\n")
             self.base_header_file.write("\t\tdouble _path_delay;\n\n")
-            self.base_header_file.write("\t\tuint64_t _available;\n\n")
-            self.base_header_file.write("\t\tuint64_t _in_use;\n\n")
+            self.base_header_file.write("\t\tuint64_t _available = 0;\n\n")
+            self.base_header_file.write("\t\tuint64_t _in_use = 0;\n\n")
             # methods
 
             # define public members and methods
@@ -290,6 +290,7 @@ class FunctionalUnitGenerator():
             self.base_header_file.write("\t\tstd::string get_alias() { return _alias; }\n")
             self.base_header_file.write("\t\tuint32_t get_stages() { return _stages; }\n")
             self.base_header_file.write("\t\tuint32_t get_cycles() { return _cycles; }\n")
+            self.base_header_file.write("\t\tuint64_t get_in_use() { return _in_use; }\n")
             self.base_header_file.write("\t\tuint32_t get_enum_value() { return _enum_value; }\n")
             self.base_header_file.write("\t\tstd::string get_int_size() { return _int_size; }\n")
             self.base_header_file.write("\t\tstd::string get_int_sign() { return _int_sign; }\n")
@@ -313,12 +314,18 @@ class FunctionalUnitGenerator():
             self.base_header_file.write("\t\tdouble get_leakage_power() { return _leakage_power; }\n")
             self.base_header_file.write("\t\tdouble get_area() { return _area; }\n")
             self.base_header_file.write("\t\tdouble get_path_delay() { return _path_delay; }\n")
-            self.base_header_file.write("\t\tbool is_available() { return (_in_use >= _available); }\n")
+            self.base_header_file.write("\t\tbool is_available() { return (_in_use < get_functional_unit_limit()); }\n")
             self.base_header_file.write("\t\tvoid use_functional_unit() { _in_use++; }\n")
-            self.base_header_file.write("\t\tvoid clear_functional_unit() { _in_use--; }\n")
+            self.base_header_file.write("\t\tvoid clear_functional_unit() { if (_in_use > 0) _in_use--; }\n")
             self.base_header_file.write("\t\tvoid set_functional_unit_limit(uint64_t available) { _available = available; }\n")
             self.base_header_file.write("\t\tvoid inc_functional_unit_limit() { _available++; }\n")
-            self.base_header_file.write("\t\tuint64_t get_functional_unit_limit() { return _available; }\n\n")
+            self.base_header_file.write("\t\t// _available counts the static instructions mapped to this unit (IR defined),\n")
+            self.base_header_file.write("\t\t// _limit caps it when set from the hardware config. 0 = IR Defined\n")
+            self.base_header_file.write("\t\tuint64_t get_functional_unit_limit() { return ((_limit > 0) && (_limit < _available)) ? _limit : _available; }\n")
+            self.base_header_file.write("\t\tvoid constrain_functional_unit_limit(uint32_t limit) { if ((limit > 0) && ((_limit == 0) || (limit < _limit))) _limit = limit; }\n")
+            self.base_header_file.write("\t\t// Pipelined units accept a new operation every initiation interval\n")
+            self.base_header_file.write("\t\tbool is_pipelined() { return (_stages > 1); }\n")
+            self.base_header_file.write("\t\tuint64_t get_initiation_interval(uint64_t latency) { return is_pipelined() ? ((latency + _stages - 1) / _stages) : latency; }\n\n")
 
 
             # end class body
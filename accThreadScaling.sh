@@ -0,0 +1,75 @@
+#!/bin/bash
+# Host thread scaling benchmark for multi-accelerator systems.
+# Builds a runMobileNetV2.sh style system once and runs it with the
+# accelerators spread over an increasing number of event queues, recording
+# host time and simulated ticks of each run.
+#
+# Usage: $0 (-b BENCHMARK) (-t THREADS)... (-q QUANTUM) (-o RESULTS.csv)
+#   BENCHMARK is a path under benchmarks/ holding a config.yml and sw/main.elf,
+#   defaults to mobilenetv2. THREADS defaults to 0 1 2 4 8, where 0 keeps all
+#   accelerators on the main event queue. QUANTUM is in ticks.
+BENCH="mobilenetv2"
+THREADS=()
+QUANTUM=1000000
+RESULTS="BM_ARM_OUT/acc_threads/results.csv"
+
+while getopts ":b:t:q:o:" opt; do
+	case $opt in
+		b )
+			BENCH=${OPTARG}
+			;;
+		t )
+			THREADS+=("${OPTARG}")
+			;;
+		q )
+			QUANTUM=${OPTARG}
+			;;
+		o )
+			RESULTS=${OPTARG}
+			;;
+		* )
+			echo "Invalid argument: ${OPTARG}"
+			echo "Usage: $0 (-b BENCHMARK) (-t THREADS) (-q QUANTUM) (-o RESULTS.csv)"
+			exit 1
+			;;
+	esac
+done
+
+if [ ${#THREADS[@]} -eq 0 ]; then
+	THREADS=(0 1 2 4 8)
+fi
+
+BINARY="${M5_PATH}/build/ARM/gem5.opt"
+NAME=$(echo ${BENCH} | tr '/' '_')
+KERNEL=$M5_PATH/benchmarks/${BENCH}/sw/main.elf
+
+SYS_OPTS="--mem-size=4GB \
+		  --mem-type=DDR4_2400_8x8 \
+		  --kernel=$KERNEL \
+		  --disk-image=$M5_PATH/baremetal/common/fake.iso \
+		  --machine-type=VExpress_GEM5_V1 \
+		  --dtb-file=none --bare-metal \
+		  --cpu-type=DerivO3CPU"
+CACHE_OPTS="--caches --l2cache"
+
+${M5_PATH}/SALAM-Configurator/systembuilder.py --sysName ${NAME} --benchDir "benchmarks/${BENCH}"
+
+mkdir -p $(dirname ${RESULTS})
+echo "threads,quantum,host_seconds,sim_ticks" > ${RESULTS}
+
+for T in "${THREADS[@]}"; do
+	OUTDIR=BM_ARM_OUT/acc_threads/${NAME}_${T}
+	mkdir -p $OUTDIR
+	echo "Running ${BENCH} on ${T} accelerator event queues"
+	$BINARY --outdir=$OUTDIR \
+		configs/SALAM/generated/fs_${NAME}.py $SYS_OPTS \
+		--accpath=$M5_PATH/benchmarks/${BENCH} \
+		--accbench=$(basename ${BENCH}) $CACHE_OPTS \
+		--acc_eventqs=${T} --acc_quantum=${QUANTUM} > ${OUTDIR}/debug-trace.txt
+	HOST=$(awk '/^hostSeconds/ { print $2; exit }' ${OUTDIR}/stats.txt)
+	TICKS=$(awk '/^simTicks/ { print $2; exit }' ${OUTDIR}/stats.txt)
+	echo "${T},${QUANTUM},${HOST},${TICKS}" >> ${RESULTS}
+done
+
+# Speedup relative to the first run
+awk -F, 'NR == 2 { base = $3 } NR > 1 { printf "%s threads: %ss host, %.2fx\n", $1, $3, base / $3 }' ${RESULTS}
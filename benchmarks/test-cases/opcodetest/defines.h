@@ -0,0 +1,24 @@
+#ifndef __DEFINES_H__
+#define __DEFINES_H__
+
+#include <inttypes.h>
+
+#define CHECK
+
+// Iterations of every opcode family
+#define N 64
+
+// One checksum per opcode family in RESULTS
+enum {
+	INT8_OPS,
+	INT16_OPS,
+	INT32_OPS,
+	INT64_OPS,
+	FLOAT_OPS,
+	DOUBLE_OPS,
+	COMPARE_OPS,
+	CAST_OPS,
+	FAMILIES
+};
+
+#endif
@@ -0,0 +1,17 @@
+#include "../opcodetest_clstr_hw_defines.h"
+#include "../opcodes.h"
+
+void top() {
+	volatile uint64_t * results = (uint64_t *)RESULTS;
+
+	results[INT8_OPS]    = int8_ops(1);
+	results[INT16_OPS]   = int16_ops(2);
+	results[INT32_OPS]   = int32_ops(3);
+	results[INT64_OPS]   = int64_ops(4);
+	results[FLOAT_OPS]   = float_ops(5);
+	results[DOUBLE_OPS]  = double_ops(6);
+	results[COMPARE_OPS] = compare_ops(7);
+	results[CAST_OPS]    = cast_ops(8);
+
+	return;
+}
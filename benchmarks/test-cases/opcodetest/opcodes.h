@@ -0,0 +1,120 @@
+#ifndef __OPCODES_H__
+#define __OPCODES_H__
+
+#include "defines.h"
+
+// Shared by the accelerator and the CPU check. Every family draws its
+// operands from an LCG and folds the results into one checksum so a wrong
+// result in any opcode changes the checksum.
+
+static uint32_t next(uint32_t x) {
+	return x * 1664525u + 1013904223u;
+}
+
+// add, sub, mul, sdiv, srem, udiv, urem, shl, lshr, ashr, and, or, xor
+#define INT_FAMILY(name, T, UT)							\
+static uint64_t name(uint32_t seed) {					\
+	uint64_t sum = 0;									\
+	int i;												\
+	for (i=0; i<N; i++) {								\
+		seed = next(seed);								\
+		T a = (T)seed;									\
+		seed = next(seed);								\
+		T b = (T)(seed >> 7);							\
+		UT ua = (UT)a;									\
+		UT ub = (UT)b;									\
+		T d = (b == 0 || b == -1) ? 3 : b;				\
+		UT ud = ub == 0 ? 3 : ub;						\
+		unsigned sh = (seed >> 3) % (sizeof(T) * 8);	\
+		UT r = (UT)(ua + ub);							\
+		r ^= (UT)(ua - ub);								\
+		r += (UT)(ua * ub);								\
+		r ^= (UT)(a / d);								\
+		r += (UT)(a % d);								\
+		r ^= (UT)(ua / ud);								\
+		r += (UT)(ua % ud);								\
+		r ^= (UT)(ua << sh);							\
+		r += (UT)(ua >> sh);							\
+		r ^= (UT)(a >> sh);								\
+		r += (UT)((ua & ub) | (ua ^ ub));				\
+		sum = sum * 31 + r;								\
+	}													\
+	return sum;											\
+}
+
+INT_FAMILY(int8_ops, int8_t, uint8_t)
+INT_FAMILY(int16_ops, int16_t, uint16_t)
+INT_FAMILY(int32_ops, int32_t, uint32_t)
+INT_FAMILY(int64_ops, int64_t, uint64_t)
+
+// fadd, fsub, fmul, fdiv, frem, fneg
+#define FP_FAMILY(name, T, FMOD)						\
+static uint64_t name(uint32_t seed) {					\
+	T sum = 0;											\
+	int i;												\
+	for (i=0; i<N; i++) {								\
+		seed = next(seed);								\
+		T a = (T)(int32_t)seed / 65536;					\
+		seed = next(seed);								\
+		T b = (T)(seed >> 8) / 256 + 1;					\
+		T r = a + b;									\
+		r -= a * (T)0.5;								\
+		r += a / b;										\
+		r += FMOD(a, b);								\
+		sum += -r;										\
+	}													\
+	return (uint64_t)(int64_t)sum;						\
+}
+
+FP_FAMILY(float_ops, float, __builtin_fmodf)
+FP_FAMILY(double_ops, double, __builtin_fmod)
+
+// icmp and fcmp on every ordered predicate, feeding selects
+static uint64_t compare_ops(uint32_t seed) {
+	uint64_t sum = 0;
+	int i;
+	for (i=0; i<N; i++) {
+		seed = next(seed);
+		int32_t a = (int32_t)seed >> 28;
+		uint32_t ua = seed;
+		seed = next(seed);
+		int32_t b = (int32_t)seed >> 28;
+		uint32_t ub = seed;
+		double x = a;
+		double y = b;
+		uint64_t r = (a < b) | (a <= b) << 1 | (a > b) << 2 | (a >= b) << 3
+				   | (a == b) << 4 | (a != b) << 5 | (ua < ub) << 6
+				   | (ua <= ub) << 7 | (ua > ub) << 8 | (ua >= ub) << 9
+				   | (x < y) << 10 | (x <= y) << 11 | (x > y) << 12
+				   | (x >= y) << 13 | (x == y) << 14 | (x != y) << 15;
+		r += a < b ? ua : ub;
+		r += x > y ? (uint64_t)a : (uint64_t)b;
+		sum = sum * 31 + r;
+	}
+	return sum;
+}
+
+// trunc, zext, sext, fptrunc, fpext, fptoui, fptosi, uitofp, sitofp
+static uint64_t cast_ops(uint32_t seed) {
+	uint64_t sum = 0;
+	int i;
+	for (i=0; i<N; i++) {
+		seed = next(seed);
+		int8_t s8 = (int8_t)seed;
+		uint16_t u16 = (uint16_t)(seed >> 8);
+		int64_t s64 = s8;
+		uint64_t u64 = u16;
+		double d = (double)(int32_t)seed / 1024;
+		float f = (float)d;
+		double e = f;
+		uint64_t r = (uint64_t)s64 + u64;
+		r ^= (uint32_t)(d < 0 ? -d : d);
+		r += (uint64_t)(int32_t)e;
+		r ^= (uint64_t)(int64_t)((float)u16 + (float)s8);
+		r += (uint64_t)(int64_t)((double)seed - (double)s64);
+		sum = sum * 31 + r;
+	}
+	return sum;
+}
+
+#endif
@@ -0,0 +1,11 @@
+//BEGIN GENERATED CODE
+//Cluster: TOP
+//NonCoherentDMA
+#define DMA_Flags 0x10020000
+#define DMA_RdAddr 0x10020001
+#define DMA_WrAddr 0x10020009
+#define DMA_CopyLen 0x10020011
+//Accelerator: TOP
+#define TOP 0x10020040
+#define RESULTS 0x10020080
+//END GENERATED CODE
\ No newline at end of file
@@ -0,0 +1,7 @@
+#ifndef DEFINES
+#include "../defines.h"
+#endif
+
+volatile int stage;
+
+#include "../opcodetest_clstr_hw_defines.h"
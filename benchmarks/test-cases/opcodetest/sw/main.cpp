@@ -0,0 +1,40 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "bench.h"
+#include "../opcodes.h"
+#include "../../../common/m5ops.h"
+
+volatile uint8_t * top  = (uint8_t *)TOP;
+
+int main(void) {
+    volatile uint64_t * results = (uint64_t *)RESULTS;
+    const char * names[FAMILIES] = { "int8", "int16", "int32", "int64",
+                                     "float", "double", "compare", "cast" };
+    volatile int count = 0;
+    stage = 0;
+
+    *top = 0x01;
+    while (stage < 1) count++;
+
+#ifdef CHECK
+    uint64_t check[FAMILIES];
+    check[INT8_OPS]    = int8_ops(1);
+    check[INT16_OPS]   = int16_ops(2);
+    check[INT32_OPS]   = int32_ops(3);
+    check[INT64_OPS]   = int64_ops(4);
+    check[FLOAT_OPS]   = float_ops(5);
+    check[DOUBLE_OPS]  = double_ops(6);
+    check[COMPARE_OPS] = compare_ops(7);
+    check[CAST_OPS]    = cast_ops(8);
+
+    for (count=0; count<FAMILIES; count++) {
+        printf("%s Check: %llx %s\n", names[count],
+               (unsigned long long)results[count],
+               results[count]==check[count] ? "PASSED" : "FAILED");
+    }
+#endif
+
+    m5_dump_stats();
+    m5_exit();
+}
@@ -14,6 +14,9 @@ def AccConfig(acc, bench_file, ir=None):
     acc.llvm_interface.in_file = bench_file
     M5_Path = os.getenv('M5_PATH')
     benchname = os.path.splitext(os.path.basename(bench_file))[0]
+    # Reuse pre-parsed bitcode across runs when a cache directory is given
+    if os.getenv('SALAM_IR_CACHE'):
+        acc.llvm_interface.ir_cache_dir = os.getenv('SALAM_IR_CACHE')
 
 
     # lenet config launcher custom stuff
@@ -32,6 +35,8 @@ def AccConfig(acc, bench_file, ir=None):
     # Define HW Counts
     acc.hw_interface.cycle_counts = CycleCounts()
     #acc.hw_interface.cycle_counts
+    # Functional unit limits per instruction, 0 = IR Defined
+    fu_limits = {}
 
     if benchname != 'top':
         if benchPath[m5PathLen+1] == 'lenet5':
@@ -42,6 +47,7 @@ def AccConfig(acc, bench_file, ir=None):
 
             for instruction in inst_list:
                 setattr(acc.hw_interface.cycle_counts, instruction, yaml_inst_list['hw_config'][benchname]['instructions'][instruction]['runtime_cycles'])
+                fu_limits[instruction] = yaml_inst_list['hw_config'][benchname]['instructions'][instruction].get('functional_unit_limit', 0)
             fu_yaml.close()
         elif benchPath[m5PathLen+1] == 'mobilenetv2':
             config_path = 'benchmarks/mobilenetv2/config.yml'
@@ -55,6 +61,7 @@ def AccConfig(acc, bench_file, ir=None):
                     inst_list = yaml_inst_list['hw_config'][current_acc]['instructions'].keys()
                     for instruction in inst_list:
                         setattr(acc.hw_interface.cycle_counts, instruction, yaml_inst_list['hw_config'][current_acc]['instructions'][instruction]['runtime_cycles'])
+                        fu_limits[instruction] = yaml_inst_list['hw_config'][current_acc]['instructions'][instruction].get('functional_unit_limit', 0)
             fu_yaml.close()
         else:
             config_path = 'benchmarks/sys_validation/' + benchname + '/config.yml'
@@ -64,6 +71,7 @@ def AccConfig(acc, bench_file, ir=None):
 
             for instruction in inst_list:
                 setattr(acc.hw_interface.cycle_counts, instruction, yaml_inst_list['hw_config'][benchname]['instructions'][instruction]['runtime_cycles'])
+                fu_limits[instruction] = yaml_inst_list['hw_config'][benchname]['instructions'][instruction].get('functional_unit_limit', 0)
             fu_yaml.close()
 
     #TODO Automate the generation of the list below
@@ -134,6 +142,11 @@ def AccConfig(acc, bench_file, ir=None):
     acc.hw_interface.inst_config.xor_inst = XorInst()
     acc.hw_interface.inst_config.zext = Zext()
 
+    # Constrain functional units with the limits from the hw_config
+    for instruction, limit in fu_limits.items():
+        if hasattr(acc.hw_interface.inst_config, instruction):
+            getattr(acc.hw_interface.inst_config, instruction).functional_unit_limit = limit
+
 
     acc.hw_interface.salam_power_model = SALAMPowerModel()
     acc.hw_interface.hw_statistics = HWStatistics()
@@ -0,0 +1,104 @@
+#!/bin/bash
+# Host-time regression benchmark for the LLVMInterface runtime.
+# Runs each benchmark, collects the Performance Analysis breakdown printed by
+# LLVMInterface::printResults() and optionally compares against a baseline csv.
+#
+# Usage: $0 (-b BENCHMARK)... (-o RESULTS.csv) (-c BASELINE.csv) (-r REVISION)
+#   BENCHMARK is a path under benchmarks/, e.g. sys_validation/gemm or
+#   lenet5-nounroll/naive. Defaults to gemm and the lenet5 variants.
+#   REVISION is a git revision to measure the baseline with. It is checked
+#   out in a worktree, built, and run on the same benchmarks, and its results
+#   become the baseline csv.
+BENCHES=()
+RESULTS="BM_ARM_OUT/host_time/results.csv"
+BASELINE=""
+BASELINE_REV=""
+
+while getopts ":b:o:c:r:" opt; do
+	case $opt in
+		b )
+			BENCHES+=("${OPTARG}")
+			;;
+		o )
+			RESULTS=${OPTARG}
+			;;
+		c )
+			BASELINE=${OPTARG}
+			;;
+		r )
+			BASELINE_REV=${OPTARG}
+			;;
+		* )
+			echo "Invalid argument: ${OPTARG}"
+			echo "Usage: $0 (-b BENCHMARK) (-o RESULTS.csv) (-c BASELINE.csv) (-r REVISION)"
+			exit 1
+			;;
+	esac
+done
+
+if [ ${#BENCHES[@]} -eq 0 ]; then
+	BENCHES=("sys_validation/gemm" \
+			 "lenet5-nounroll/naive" \
+			 "lenet5-kernelunroll/naive" \
+			 "lenet5-channelunroll/naive")
+fi
+
+# Runs every benchmark with the gem5 tree at ROOT and appends to RESULTS
+run_benches() {
+	ROOT=$1
+	RESULTS_CSV=$2
+	LABEL=$3
+	BINARY="${ROOT}/build/ARM/gem5.opt"
+
+	mkdir -p $(dirname ${RESULTS_CSV})
+	rm -f ${RESULTS_CSV}
+
+	for BENCH in "${BENCHES[@]}"; do
+		NAME=$(echo ${BENCH} | tr '/' '_')
+		BENCH_DIR=$(dirname ${BENCH})
+		BENCH_NAME=$(basename ${BENCH})
+		OUTDIR=${M5_PATH}/BM_ARM_OUT/host_time/${LABEL}/${NAME}
+		KERNEL=$M5_PATH/benchmarks/${BENCH}/sw/main.elf
+
+		SYS_OPTS="--mem-size=4GB \
+				  --mem-type=DDR4_2400_8x8 \
+				  --kernel=$KERNEL \
+				  --disk-image=$M5_PATH/baremetal/common/fake.iso \
+				  --machine-type=VExpress_GEM5_V1 \
+				  --dtb-file=none --bare-metal \
+				  --cpu-type=DerivO3CPU"
+		CACHE_OPTS="--caches --l2cache"
+
+		pushd ${ROOT} > /dev/null
+		${ROOT}/SALAM-Configurator/systembuilder.py --sysName ${NAME} --benchDir "benchmarks/${BENCH}"
+
+		RUN_SCRIPT="$BINARY --outdir=$OUTDIR \
+					configs/SALAM/generated/fs_${NAME}.py $SYS_OPTS \
+					--accpath=$M5_PATH/benchmarks/${BENCH_DIR} \
+					--accbench=${BENCH_NAME} $CACHE_OPTS"
+
+		mkdir -p $OUTDIR
+		echo "Running ${BENCH} (${LABEL})"
+		$RUN_SCRIPT > ${OUTDIR}/debug-trace.txt
+		popd > /dev/null
+		python3 ${M5_PATH}/src/hwacc/Scripts/hostTimeParser.py -f ${OUTDIR}/debug-trace.txt -b ${BENCH} -d ${RESULTS_CSV}
+	done
+}
+
+if [ "${BASELINE_REV}" != "" ]; then
+	BASELINE_ROOT=${M5_PATH}/BM_ARM_OUT/host_time/baseline-src
+	if [ ! -d ${BASELINE_ROOT} ]; then
+		git -C ${M5_PATH} worktree add --detach ${BASELINE_ROOT} ${BASELINE_REV} || exit 1
+	else
+		git -C ${BASELINE_ROOT} checkout --detach ${BASELINE_REV} || exit 1
+	fi
+	(cd ${BASELINE_ROOT} && scons build/ARM/gem5.opt -j$(nproc)) || exit 1
+	BASELINE=${M5_PATH}/BM_ARM_OUT/host_time/baseline.csv
+	run_benches ${BASELINE_ROOT} ${BASELINE} baseline
+fi
+
+run_benches ${M5_PATH} ${RESULTS} current
+
+if [ "${BASELINE}" != "" ]; then
+	python3 ${M5_PATH}/src/hwacc/Scripts/hostTimeParser.py -d ${RESULTS} -c ${BASELINE}
+fi
@@ -10,6 +10,10 @@ from m5.objects.Cache import Cache
 from m5.objects.CommInterface import CommInterface
 from m5.objects.NoncoherentDma import NoncoherentDma
 from m5.objects.StreamDma import StreamDma
+from m5.objects.StreamBuffer import StreamBuffer
+from m5.objects.ScratchpadMemory import ScratchpadMemory
+from m5.objects.RegisterBank import RegisterBank
+from m5.objects.EventQueueBridge import EventQueueBridge
 
 class ClusterCache(Cache):
     assoc = 8
@@ -83,3 +87,108 @@ class AccCluster(Platform):
     def _connect_cluster_dma(self, system, dma):
         self._connect_dma(system, dma)
         dma.cluster_dma = self.local_bus.slave
+
+    # Accelerators can be simulated on their own event queues so that
+    # independent accelerators in a cluster run on separate host threads.
+    # An accelerator and the private devices wired to it form a group that
+    # shares one queue. Everything the group exchanges with the cluster
+    # crosses an EventQueueBridge at the local xbar.
+    def _acc_groups(self):
+        if not '_groups' in self.__dict__:
+            self._groups = []
+        return self._groups
+
+    def _find_acc_group(self, obj):
+        for group in self._acc_groups():
+            if any(member is obj for member in group['members']):
+                return group
+        return None
+
+    def _acc_group(self, acc):
+        group = self._find_acc_group(acc)
+        if group is None:
+            group = {'members': [acc], 'outbound': [], 'paths': [], 'pinned': False}
+            self._acc_groups().append(group)
+        return group
+
+    def _threaded(self, options):
+        return getattr(options, 'acc_eventqs', 0) > 0
+
+    def _acc_local_port(self, options, acc):
+        if not self._threaded(options):
+            return self.local_bus.cpu_side_ports
+        group = self._acc_group(acc)
+        bridge = EventQueueBridge()
+        setattr(self, acc._name + '_outbound', bridge)
+        bridge.mem_side = self.local_bus.cpu_side_ports
+        group['outbound'].append(bridge)
+        return bridge.cpu_side
+
+    # Cluster side accesses to the accelerator MMRs, or to a private device
+    # when dev is given, arrive through a per accelerator bus
+    def _acc_pio_port(self, options, acc, dev=None):
+        if not self._threaded(options):
+            return self.local_bus.mem_side_ports
+        group = self._acc_group(acc)
+        path = next((p for p in group['paths'] if p['acc'] is acc), None)
+        if path is None:
+            path = {'acc': acc, 'ranges': [],
+                    'bus': NoncoherentXBar(width=2, frontend_latency=1,
+                                           forward_latency=0, response_latency=1),
+                    'inbound': EventQueueBridge()}
+            setattr(self, acc._name + '_bus', path['bus'])
+            setattr(self, acc._name + '_inbound', path['inbound'])
+            path['inbound'].cpu_side = self.local_bus.mem_side_ports
+            path['inbound'].mem_side = path['bus'].cpu_side_ports
+            group['paths'].append(path)
+        if dev is None:
+            path['ranges'].append(AddrRange(acc.pio_addr, size=acc.pio_size))
+        else:
+            self._tie_eventqs(acc, dev)
+            path['ranges'].append(dev.range)
+        path['inbound'].ranges = path['ranges']
+        return path['bus'].mem_side_ports
+
+    # Objects wired to each other directly have to share a queue. Passive
+    # devices join the group, while tying an accelerator to anything else,
+    # e.g. a cluster DMA or a coherent cache, keeps it on the cluster queue.
+    def _tie_eventqs(self, *objs):
+        accs = [obj for obj in objs if isinstance(obj, CommInterface)]
+        if not accs:
+            return
+        merged = self._acc_group(accs[0])
+        for obj in objs:
+            group = self._find_acc_group(obj)
+            if group is merged:
+                continue
+            if group is not None:
+                for key in ('members', 'outbound', 'paths'):
+                    merged[key] += group[key]
+                merged['pinned'] = merged['pinned'] or group['pinned']
+                self._acc_groups().remove(group)
+            elif isinstance(obj, CommInterface) or \
+                 isinstance(obj, (ScratchpadMemory, RegisterBank, StreamBuffer)):
+                merged['members'].append(obj)
+            else:
+                merged['pinned'] = True
+
+    # Places the accelerator groups round robin on queues first to
+    # first + count - 1 and sizes the crossing delays to the quantum (in
+    # ticks). Returns the round robin position for the next cluster
+    def _assign_eventqs(self, first, count, quantum, queue=0):
+        for group in self._acc_groups():
+            index = 0
+            if not group['pinned'] and count > 0:
+                index = first + (queue % count)
+                queue += 1
+            delay = str(quantum) + 't' if index else '1ns'
+            for member in group['members']:
+                member.eventq_index = index
+            for path in group['paths']:
+                path['bus'].eventq_index = index
+                path['inbound'].mem_side_eventq = index
+                path['inbound'].delay = delay
+            for bridge in group['outbound']:
+                bridge.cpu_side_eventq = index
+                bridge.delay = delay
+        return queue
@@ -23,4 +23,6 @@ class CommInterface(BasicPioDevice):
     premap_data = Param.Bool(False, "Whether or not the memory read/write locations for data predefined")
     data_bases = VectorParam.Addr([0x0], "Base addresses for data if they are predefined")
     enable_debug_msgs = Param.Bool(False, "Whether or not this device will display debug messages")
-    reset_spm = Param.Bool(False, "Reset the ready state of any connected scratchpad memories when finished executing")
\ No newline at end of file
+    reset_spm = Param.Bool(False, "Reset the ready state of any connected scratchpad memories when finished executing")
+    coalesce_requests = Param.Bool(False, "Merge requests to contiguous addresses issued in the same cycle into bursts")
+    max_burst_size = Param.Unsigned(0, "Largest coalesced burst in bytes, 0 = cache line size")
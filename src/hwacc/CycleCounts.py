@@ -48,7 +48,7 @@ class CycleCounts(SimObject):
     store = Param.UInt32(0, "Must be 0, handled by memory controller")
     fence = Param.UInt32(1, "Fence intructions runtime cycles.")
     cmpxchg = Param.UInt32(1, "Compare and exchange intructions runtime cycles.")
-    atomicrmw = Param.UInt32(1, "Atomic remove intructions runtime cycles.")
+    atomicrmw = Param.UInt32(1, "Atomic read-modify-write intructions runtime cycles.")
     extractvalue = Param.UInt32(1, "Extract value intructions runtime cycles.")
     insertvalue = Param.UInt32(1, "Insert value intructions runtime cycles.")
     extractelement = Param.UInt32(1, "Extract element intructions runtime cycles.")
@@ -71,4 +71,8 @@ class CycleCounts(SimObject):
     fsub = Param.UInt32(5, "Floating point subtraction intructions runtime cycles.")
     fmul = Param.UInt32(4, "Floating point multiplication intructions runtime cycles.")
     fdiv = Param.UInt32(16, "Floating point division intructions runtime cycles.")
-    frem = Param.UInt32(5, "Floating point remainder intructions runtime cycles.")
\ No newline at end of file
+    frem = Param.UInt32(5, "Floating point remainder intructions runtime cycles.")
+    fmuladd = Param.UInt32(5, "Fused multiply-add intrinsic runtime cycles.")
+    sqrt = Param.UInt32(16, "Square root intrinsic runtime cycles.")
+    fabs = Param.UInt32(1, "Floating point absolute value intrinsic runtime cycles.")
+    fminmax = Param.UInt32(1, "Floating point minimum and maximum intrinsic runtime cycles.")
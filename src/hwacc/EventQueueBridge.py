@@ -0,0 +1,14 @@
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+class EventQueueBridge(SimObject):
+    type = 'EventQueueBridge'
+    cxx_header = 'hwacc/event_queue_bridge.hh'
+
+    cpu_side = ResponsePort("Responder port facing the requestors")
+    mem_side = RequestPort("Requestor port facing the responders")
+    cpu_side_eventq = Param.UInt32(0, "Event queue the requestors run on")
+    mem_side_eventq = Param.UInt32(0, "Event queue the responders run on")
+    delay = Param.Latency('1ns', "Crossing latency, at least the sim quantum between queues")
+    ranges = VectorParam.AddrRange([AllMemory], "Address ranges passed to the mem side")
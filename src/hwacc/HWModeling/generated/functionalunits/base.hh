@@ -39,7 +39,7 @@ class FunctionalUnitBase
 		double _area;
 		double _path_delay;
 
-		uint64_t _available;
+		uint64_t _available = 0;
 
 		uint64_t _in_use = 0;
 
@@ -124,12 +124,18 @@ class FunctionalUnitBase
 		double get_leakage_power() { return _leakage_power; }
 		double get_area() { return _area; }
 		double get_path_delay() { return _path_delay; }
-		bool is_available() { return (_in_use >= _available); }
+		bool is_available() { return (_in_use < get_functional_unit_limit()); }
 		void use_functional_unit() { _in_use++; }
-		void clear_functional_unit() { _in_use--; }
+		void clear_functional_unit() { if (_in_use > 0) _in_use--; }
 		void set_functional_unit_limit(uint64_t available) { _available = available; }
 		void inc_functional_unit_limit() { _available++; }
-		uint64_t get_functional_unit_limit() { return _available; }
+		// _available counts the static instructions mapped to this unit (IR defined),
+		// _limit caps it when set from the hardware config. 0 = IR Defined
+		uint64_t get_functional_unit_limit() { return ((_limit > 0) && (_limit < _available)) ? _limit : _available; }
+		void constrain_functional_unit_limit(uint32_t limit) { if ((limit > 0) && ((_limit == 0) || (limit < _limit))) _limit = limit; }
+		// Pipelined units accept a new operation every initiation interval
+		bool is_pipelined() { return (_stages > 1); }
+		uint64_t get_initiation_interval(uint64_t latency) { return is_pipelined() ? ((latency + _stages - 1) / _stages) : latency; }
 
 };
 #endif // __HWMODEL_FUNCTIONAL_UNIT_BASE_HH__
\ No newline at end of file
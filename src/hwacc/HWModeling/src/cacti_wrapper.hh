@@ -5,5 +5,8 @@
 
 
 uca_org_t cactiWrapper(unsigned num_of_bytes, unsigned wordsize, unsigned num_ports, int cache_type);
+// Banked scratchpads are modeled one bank at a time. Area and leakage of the
+// memory scale with num_banks, dynamic energy is per access to a single bank.
+uca_org_t cactiBankWrapper(unsigned num_of_bytes, unsigned wordsize, unsigned ports_per_bank, unsigned num_banks, int cache_type);
 
 #endif //__HWMODEL_CACTI_WRAPPER_HH__
\ No newline at end of file
@@ -62,7 +62,11 @@ CycleCounts::CycleCounts(const CycleCountsParams &p):
     fsub_inst(p.fsub),
     fmul_inst(p.fmul),
     fdiv_inst(p.fdiv),
-    frem_inst(p.frem)
+    frem_inst(p.frem),
+    fmuladd_inst(p.fmuladd),
+    sqrt_inst(p.sqrt),
+    fabs_inst(p.fabs),
+    fminmax_inst(p.fminmax)
     { }
 
 
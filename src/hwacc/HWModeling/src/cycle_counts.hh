@@ -72,6 +72,10 @@ class CycleCounts : public SimObject
     uint32_t fmul_inst;
     uint32_t fdiv_inst;
     uint32_t frem_inst;
+    uint32_t fmuladd_inst;
+    uint32_t sqrt_inst;
+    uint32_t fabs_inst;
+    uint32_t fminmax_inst;
     CycleCounts();
     CycleCounts(const CycleCountsParams &p);
 };
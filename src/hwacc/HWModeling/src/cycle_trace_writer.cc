@@ -0,0 +1,111 @@
+#include "cycle_trace_writer.hh"
+
+#include "base/logging.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+CycleTraceWriter::CycleTraceWriter(const std::string &path,
+                                   const std::vector<std::string> &fields,
+                                   size_t ring_records, bool compress) :
+    recordWords(fields.size()),
+    capacity(std::max<size_t>(ring_records, 1)),
+    ring(capacity * recordWords),
+    head(0),
+    tail(0),
+    closing(false),
+    fullStalls(0),
+    file(nullptr),
+    gzfile(nullptr) {
+    if (compress) {
+        gzfile = gzopen(path.c_str(), "wb");
+        fatal_if(!gzfile, "Could not open cycle trace %s\n", path);
+    } else {
+        file = std::fopen(path.c_str(), "wb");
+        fatal_if(!file, "Could not open cycle trace %s\n", path);
+    }
+    // Header: magic, format version, field count and the length prefixed
+    // name of each field
+    writeOut("SALAMHWS", 8);
+    uint32_t count = fields.size();
+    writeOut(&version, sizeof(version));
+    writeOut(&count, sizeof(count));
+    for (auto &field : fields) {
+        uint32_t length = field.size();
+        writeOut(&length, sizeof(length));
+        writeOut(field.data(), length);
+    }
+    worker = std::thread(&CycleTraceWriter::run, this);
+}
+
+CycleTraceWriter::~CycleTraceWriter() {
+    close();
+}
+
+void
+CycleTraceWriter::push(const int32_t * record) {
+    if (!worker.joinable()) return;
+    uint64_t pushed = head.load(std::memory_order_relaxed);
+    if (pushed - tail.load(std::memory_order_acquire) == capacity) {
+        // The writer is a whole ring behind, wait for it to free a slot
+        std::unique_lock<std::mutex> guard(lock);
+        fullStalls++;
+        dataReady.notify_one();
+        spaceReady.wait(guard, [&] {
+            return pushed - tail.load(std::memory_order_acquire) < capacity;
+        });
+    }
+    std::memcpy(&ring[(pushed % capacity) * recordWords], record, recordWords * sizeof(int32_t));
+    head.store(pushed + 1, std::memory_order_release);
+    // Hand over in batches so the writer is not woken every cycle
+    if ((pushed + 1) % std::max<size_t>(capacity / 4, 1) == 0) dataReady.notify_one();
+}
+
+void
+CycleTraceWriter::run() {
+    while (true) {
+        uint64_t written = tail.load(std::memory_order_relaxed);
+        uint64_t pushed = head.load(std::memory_order_acquire);
+        if (pushed == written) {
+            if (closing.load(std::memory_order_acquire)) {
+                if (head.load(std::memory_order_acquire) == written) break;
+                continue;
+            }
+            std::unique_lock<std::mutex> guard(lock);
+            dataReady.wait_for(guard, std::chrono::milliseconds(10), [&] {
+                return (head.load(std::memory_order_acquire) != written) ||
+                       closing.load(std::memory_order_acquire);
+            });
+            continue;
+        }
+        // Write out the contiguous run up to the end of the ring
+        uint64_t first = written % capacity;
+        uint64_t count = std::min<uint64_t>(pushed - written, capacity - first);
+        writeOut(&ring[first * recordWords], count * recordWords * sizeof(int32_t));
+        tail.store(written + count, std::memory_order_release);
+        std::lock_guard<std::mutex> guard(lock);
+        spaceReady.notify_one();
+    }
+}
+
+void
+CycleTraceWriter::writeOut(const void * data, size_t bytes) {
+    if (gzfile) {
+        panic_if(gzwrite(gzfile, data, bytes) != (int)bytes, "Cycle trace write failed\n");
+    } else {
+        panic_if(std::fwrite(data, 1, bytes, file) != bytes, "Cycle trace write failed\n");
+    }
+}
+
+void
+CycleTraceWriter::close() {
+    if (!worker.joinable()) return;
+    closing.store(true, std::memory_order_release);
+    dataReady.notify_one();
+    worker.join();
+    if (gzfile) gzclose(gzfile);
+    if (file) std::fclose(file);
+    gzfile = nullptr;
+    file = nullptr;
+}
@@ -0,0 +1,57 @@
+#ifndef __HWMODEL_CYCLE_TRACE_WRITER_HH__
+#define __HWMODEL_CYCLE_TRACE_WRITER_HH__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+
+/***************************************************************************************
+ * CycleTraceWriter streams fixed size binary records to a file from a background
+ * thread. The simulator copies each record into a bounded ring and only blocks when
+ * the writer has fallen a full ring behind. The file starts with a header naming the
+ * fields of a record, followed by the records as little endian int32 words. The whole
+ * file is gzip compressed when requested. Scripts/statParser.py reads it back.
+ **************************************************************************************/
+class CycleTraceWriter
+{
+    private:
+        const size_t recordWords;
+        const size_t capacity;
+        std::vector<int32_t> ring;
+        // Records pushed by the simulator and records written out. Only the
+        // simulator advances head and only the writer advances tail
+        std::atomic<uint64_t> head;
+        std::atomic<uint64_t> tail;
+        std::atomic<bool> closing;
+        uint64_t fullStalls;
+        std::mutex lock;
+        std::condition_variable dataReady;
+        std::condition_variable spaceReady;
+        std::thread worker;
+        std::FILE * file;
+        gzFile gzfile;
+
+        void run();
+        void writeOut(const void * data, size_t bytes);
+
+    public:
+        static constexpr uint32_t version = 1;
+        CycleTraceWriter(const std::string &path, const std::vector<std::string> &fields,
+                         size_t ring_records, bool compress);
+        ~CycleTraceWriter();
+        // Copies one record of fields.size() words into the ring
+        void push(const int32_t * record);
+        // Drains the ring and closes the file. Further records are dropped
+        void close();
+        uint64_t records() const { return head.load(std::memory_order_relaxed); }
+        uint64_t stalls() const { return fullStalls; }
+};
+
+#endif //__HWMODEL_CYCLE_TRACE_WRITER_HH__
@@ -1,5 +1,7 @@
 #include "hw_interface.hh"
 
+#include <algorithm>
+
 HWInterface::HWInterface(const HWInterfaceParams &params) :
     SimObject(params),
     cycle_counts(params.cycle_counts),
@@ -10,147 +12,56 @@ HWInterface::HWInterface(const HWInterfaceParams &params) :
     salam_power_model(params.salam_power_model),
     simulator_config(params.simulator_config) { }
 
-bool 
-HWInterface::availableFunctionalUnit(uint64_t functional_unit) {
-    //std::cout << "\n\n\nTest 1 - " <<  functional_unit << "\n\n\n";
+FunctionalUnitBase *
+HWInterface::getFunctionalUnit(uint64_t functional_unit) {
     switch(functional_unit) {
-        case INTADDER : {
-            if (functional_units->_integer_adder->is_available()) {
-                functional_units->_integer_adder->use_functional_unit();
-                return true;
-            } break;
-        }
-        case INTMULTI : {
-            if (functional_units->_integer_multiplier->is_available()) {
-                functional_units->_integer_multiplier->use_functional_unit();
-                return true;
-            } break;
-        }
-        case INTSHIFTER : {
-            if (functional_units->_bit_shifter->is_available()) {
-                functional_units->_bit_shifter->use_functional_unit();
-                return true;
-            } break;
-        } 
-        case INTBITWISE : {
-            //std::cout << "\n\n\nTest 1 - 1 -";
-            //std::cout << functional_units->_bitwise_operations->get_alias() << "\n\n\n";
-            if (functional_units->_bitwise_operations->is_available()) {
-                //std::cout << "\n\n\nTest 1 - 2\n\n\n";
-                functional_units->_bitwise_operations->use_functional_unit();
-                //std::cout << "\n\n\nTest 1 - 3\n\n\n";
-                return true;
-            } break;
-        }
-        case FPSPADDER : {
-            if (functional_units->_float_adder->is_available()) {
-                functional_units->_float_adder->use_functional_unit();
-                return true;
-            } break;
-        }
-        case FPDPADDER : {
-            if (functional_units->_double_adder->is_available()) {
-                functional_units->_double_adder->use_functional_unit();
-                return true;
-            } break;
-        }
-        case FPSPMULTI : {
-            if (functional_units->_float_multiplier->is_available()) {
-                functional_units->_float_multiplier->use_functional_unit();
-                return true;
-            } break;
-        }
-        case FPSPDIVID : {
-            if (functional_units->_float_divider->is_available()) {
-                functional_units->_float_divider->use_functional_unit();
-                return true;
-            } break;
-        }
-        case FPDPMULTI : {
-            if (functional_units->_double_multiplier->is_available()) {
-                functional_units->_double_multiplier->use_functional_unit();
-                return true;
-            } break;
-        }
-        case FPDPDIVID : {
-            if (functional_units->_double_divider->is_available()) {
-                functional_units->_double_divider->use_functional_unit();
-                return true;
-            } break;
-        }
-        case COMPARE : { break; }
-        case GETELEMENTPTR : { break; }
-        case CONVERSION : { break; }
-        case OTHERINST : { break; }
-        case REGISTER : {
-            if (functional_units->_bit_register->is_available()) {
-                functional_units->_bit_register->use_functional_unit();
-                return true;
-            } break;
-        }
-        case COUNTER : { break; }
-        default: { 
-            // assert() 
-            return false;
-        }
+        case INTADDER : return functional_units->_integer_adder;
+        case INTMULTI : return functional_units->_integer_multiplier;
+        case INTSHIFTER : return functional_units->_bit_shifter;
+        case INTBITWISE : return functional_units->_bitwise_operations;
+        case FPSPADDER : return functional_units->_float_adder;
+        case FPDPADDER : return functional_units->_double_adder;
+        case FPSPMULTI : return functional_units->_float_multiplier;
+        case FPSPDIVID : return functional_units->_float_divider;
+        case FPDPMULTI : return functional_units->_double_multiplier;
+        case FPDPDIVID : return functional_units->_double_divider;
+        case REGISTER : return functional_units->_bit_register;
+        // COMPARE, GETELEMENTPTR, CONVERSION, OTHERINST and COUNTER are not
+        // backed by a functional unit model
+        default: return nullptr;
     }
-    return false;
+}
+
+// Vector operations take one unit per lane. Lanes beyond the number of units
+// share them, so at most every unit of the type is claimed
+static uint64_t
+unitsForLanes(FunctionalUnitBase * unit, uint64_t lanes) {
+    uint64_t limit = unit->get_functional_unit_limit();
+    return std::max<uint64_t>(1, std::min(lanes, limit));
+}
+
+bool
+HWInterface::availableFunctionalUnit(uint64_t functional_unit, uint64_t lanes) {
+    FunctionalUnitBase * unit = getFunctionalUnit(functional_unit);
+    // Unmodeled units never constrain issue
+    if (unit == nullptr) return true;
+    uint64_t claim = unitsForLanes(unit, lanes);
+    if (unit->get_in_use() + claim > unit->get_functional_unit_limit()) return false;
+    for (uint64_t i = 0; i < claim; i++) unit->use_functional_unit();
+    return true;
 }
 
 void
-HWInterface::clearFunctionalUnit(uint64_t unit) {
-    switch(unit) {
-        case INTADDER : { 
-                functional_units->_integer_adder->clear_functional_unit();
-                break;
-            } 
-        case INTMULTI : { 
-                functional_units->_integer_multiplier->clear_functional_unit();
-                break;
-            }
-        case INTSHIFTER : { 
-                functional_units->_bit_shifter->clear_functional_unit();
-                break;
-            }
-        case INTBITWISE : { 
-                functional_units->_bitwise_operations->clear_functional_unit();
-                break;
-            }
-        case FPSPADDER : { 
-                functional_units->_float_adder->clear_functional_unit();
-                break;
-            }
-        case FPDPADDER : { 
-                functional_units->_double_adder->clear_functional_unit();
-                break;
-            }
-        case FPSPMULTI : { 
-                functional_units->_float_multiplier->clear_functional_unit();
-                break;
-            }
-        case FPSPDIVID : { 
-                functional_units->_float_divider->clear_functional_unit();
-                break;
-            }
-        case FPDPMULTI : { 
-                functional_units->_double_multiplier->clear_functional_unit();
-                break;
-            }
-        case FPDPDIVID : { 
-                functional_units->_double_divider->clear_functional_unit();
-                break;
-            }
-        case COMPARE : { break; }
-        case GETELEMENTPTR : { break; }
-        case CONVERSION : { break; }
-        case OTHERINST : { break; }
-        case REGISTER : { 
-                functional_units->_bit_register->clear_functional_unit();
-                break;
-            }
-        case COUNTER : { break; }
-        default: { 
-            // assert() 
-        }
-    }
-}
\ No newline at end of file
+HWInterface::clearFunctionalUnit(uint64_t functional_unit, uint64_t lanes) {
+    FunctionalUnitBase * unit = getFunctionalUnit(functional_unit);
+    if (unit == nullptr) return;
+    uint64_t claim = unitsForLanes(unit, lanes);
+    for (uint64_t i = 0; i < claim; i++) unit->clear_functional_unit();
+}
+
+uint64_t
+HWInterface::getInitiationInterval(uint64_t functional_unit, uint64_t latency) {
+    FunctionalUnitBase * unit = getFunctionalUnit(functional_unit);
+    if (unit == nullptr) return latency;
+    return unit->get_initiation_interval(latency);
+}
@@ -36,8 +36,10 @@ class HWInterface : public SimObject
 
         HWInterface();
         HWInterface(const HWInterfaceParams &params);
-        bool availableFunctionalUnit(uint64_t functional_unit);
-        void clearFunctionalUnit(uint64_t functional_unit);
+        FunctionalUnitBase * getFunctionalUnit(uint64_t functional_unit);
+        bool availableFunctionalUnit(uint64_t functional_unit, uint64_t lanes = 1);
+        void clearFunctionalUnit(uint64_t functional_unit, uint64_t lanes = 1);
+        uint64_t getInitiationInterval(uint64_t functional_unit, uint64_t latency);
         
 
 };
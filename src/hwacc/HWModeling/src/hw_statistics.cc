@@ -1,30 +1,55 @@
 #include "hw_statistics.hh"
 
+#include "base/output.hh"
+#include "sim/sim_exit.hh"
+
+// Field order of a cycle trace record. The functional unit usage follows
+static const std::vector<std::string> cycleFields = {
+    "cycle", "resInFlight",
+    "loadInFlight", "loadInternal", "loadActive", "loadRawStall",
+    "storeInFlight", "storeActive",
+    "compInFlight", "compLaunched", "compActive", "compFUStall", "compCommited"
+};
+
 HWStatistics::HWStatistics(const HWStatisticsParams &params) :
-    SimObject(params) { 
-        
-        statBufferSize = 10000;
-        statBufferPreDefine = 2;
+    SimObject(params),
+    fu_offset(cycleFields.size()),
+    cycle_tracking(params.cycle_tracking),
+    trace_file(params.cycle_trace_file),
+    trace_buffer_records(params.cycle_trace_buffer),
+    trace_compress(params.cycle_trace_compress),
+    stats(*this) {
         dbg = false;
-
-        for (int i=0 ; i<statBufferPreDefine; i++ ) {
-            std::vector<HW_Cycle_Stats> hw_cycle_buffer;
-            hw_cycle_buffer.reserve(statBufferSize);
-            hw_buffer_list.push_back(hw_cycle_buffer);
-        }
-        hw_buffer = hw_buffer_list.begin();
-        cycle_buffer = hw_buffer->begin();
+        if (trace_file.empty())
+            trace_file = name() + ".cycles.bin" + (trace_compress ? ".gz" : "");
         clearStats();
+        // SimObjects outlive the simulation, flush the trace on exit
+        registerExitCallback([this]() { closeCycleTrace(); });
     }
 
+HWStatistics::~HWStatistics() {
+    closeCycleTrace();
+}
+
+void
+HWStatistics::startCycleTrace(const std::vector<std::string> &fu_aliases) {
+    if (!cycle_tracking || cycle_trace) return;
+    std::vector<std::string> fields(cycleFields);
+    for (auto &alias : fu_aliases) fields.push_back("fu_" + alias);
+    cycle_record.assign(fields.size(), 0);
+    std::string path = simout.resolve(trace_file);
+    if (dbg) DPRINTF(SALAM_Debug, "Streaming cycle statistics to %s\n", path);
+    cycle_trace.reset(new CycleTraceWriter(path, fields, trace_buffer_records, trace_compress));
+}
+
+void
+HWStatistics::closeCycleTrace() {
+    if (cycle_trace) cycle_trace->close();
+}
 
 void
 HWStatistics::updateHWStatsCycleStart() {
-    if (dbg) DPRINTF(SALAM_Debug, "Updating Cycle Statistics Buffer\n");
-    (*hw_buffer).insert(cycle_buffer, current_cycle_stats);
     clearStats();
-    updateBuffer();
-    
 }
 
 void
@@ -34,45 +59,64 @@ HWStatistics::clearStats() {
     
 }
 
+void
+HWStatistics::addCycleStats(const HW_Cycle_Stats &function_stats) {
+    current_cycle_stats.resInFlight += function_stats.resInFlight;
+    current_cycle_stats.loadInFlight += function_stats.loadInFlight;
+    current_cycle_stats.loadInternal += function_stats.loadInternal;
+    current_cycle_stats.loadAcitve += function_stats.loadAcitve;
+    current_cycle_stats.loadRawStall += function_stats.loadRawStall;
+    current_cycle_stats.storeInFlight += function_stats.storeInFlight;
+    current_cycle_stats.storeActive += function_stats.storeActive;
+    current_cycle_stats.compInFlight += function_stats.compInFlight;
+    current_cycle_stats.compLaunched += function_stats.compLaunched;
+    current_cycle_stats.compActive += function_stats.compActive;
+    current_cycle_stats.compFUStall += function_stats.compFUStall;
+    current_cycle_stats.compCommited += function_stats.compCommited;
+}
+
 void
 HWStatistics::updateHWStatsCycleEnd(int curr_cycle) {
     if (dbg) DPRINTF(SALAM_Debug, "Updating Cycle Statistics\n");
     current_cycle_stats.cycle = curr_cycle;
-
+    if (!cycle_trace) return;
+    auto &c = current_cycle_stats;
+    int32_t * r = cycle_record.data();
+    r[0] = c.cycle;
+    r[1] = c.resInFlight;
+    r[2] = c.loadInFlight;
+    r[3] = c.loadInternal;
+    r[4] = c.loadAcitve;
+    r[5] = c.loadRawStall;
+    r[6] = c.storeInFlight;
+    r[7] = c.storeActive;
+    r[8] = c.compInFlight;
+    r[9] = c.compLaunched;
+    r[10] = c.compActive;
+    r[11] = c.compFUStall;
+    r[12] = c.compCommited;
+    cycle_trace->push(r);
 }
 
-void
-HWStatistics::updateBuffer() {
-    if (dbg) DPRINTF(SALAM_Debug, "Checking Buffer[%i][%i]\n", current_buffer_index, hw_buffer_list.at(current_buffer_index).size());
-    if (hw_buffer_list.at(current_buffer_index).size() == statBufferSize) {
-        current_buffer_index++;
-        if(current_buffer_index == statBufferPreDefine) {
-            if (dbg) DPRINTF(SALAM_Debug, "Creating New Buffer Window\n");
-            std::vector<HW_Cycle_Stats> hw_cycle_buffer;
-            hw_cycle_buffer.reserve(statBufferSize);
-            hw_buffer_list.push_back(hw_cycle_buffer);
-            hw_buffer = hw_buffer_list.end();
-            cycle_buffer = hw_buffer->begin();
-        } else {
-            if (dbg) DPRINTF(SALAM_Debug, "Next Buffer Window\n");
-            hw_buffer++;
-            cycle_buffer = hw_buffer->begin();
-        }
-    } else {
-        cycle_buffer = hw_buffer->end();
-    }
+HWStatistics::HWStatisticsStats::HWStatisticsStats(HWStatistics &hw_statistics)
+    : statistics::Group(&hw_statistics),
+    ADD_STAT(cycleRecords, statistics::units::Count::get(),
+             "Per cycle records streamed to the cycle trace"),
+    ADD_STAT(cycleTraceStalls, statistics::units::Count::get(),
+             "Records that waited for the trace writer to free a ring slot")
+{
+    cycleRecords.functor([&hw_statistics]() -> uint64_t {
+        return hw_statistics.cycle_trace ? hw_statistics.cycle_trace->records() : 0;
+    });
+    cycleTraceStalls.functor([&hw_statistics]() -> uint64_t {
+        return hw_statistics.cycle_trace ? hw_statistics.cycle_trace->stalls() : 0;
+    });
 }
 
 
 void
 HWStatistics::print() {
-    if (dbg) DPRINTF(SALAM_Debug," Buffers: %i\n", (current_buffer_index + 1));
-    for (auto buffers : hw_buffer_list) {
-        for (auto cycles : buffers) {
-            // This loops through the full runtime, starting at cycle 1 to completion
-            //std::cout << " Cycle: " << cycles.cycle;
-        }
-    }
+    // Per cycle results are streamed to the cycle trace, see Scripts/statParser.py
 
 
 /*
@@ -2,13 +2,16 @@
 #define __HWMODEL_HW_STATISTICS_HH__
 
 #include "params/HWStatistics.hh"
+#include "base/statistics.hh"
 #include "sim/sim_object.hh"
 
 #include "hwacc/LLVMRead/src/debug_flags.hh"
+#include "cycle_trace_writer.hh"
 
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <memory>
 #include <vector>
 
 using namespace gem5;
@@ -50,8 +53,16 @@ struct HW_Cycle_Stats {
         cycle = 0;
         resInFlight = 0;
         loadInFlight = 0;
+        loadInternal = 0;
+        loadAcitve = 0;
+        loadRawStall = 0;
         storeInFlight = 0;
+        storeActive = 0;
         compInFlight = 0;
+        compLaunched = 0;
+        compActive = 0;
+        compFUStall = 0;
+        compCommited = 0;
     }
 };
 
@@ -59,33 +70,48 @@ class HWStatistics : public SimObject
 {
     private:
         HW_Params hw_params;
+        // Sum over the active functions of the current cycle
         HW_Cycle_Stats current_cycle_stats;
-        std::vector<HW_Cycle_Stats>::iterator cycle_buffer;
-        std::vector<std::vector<HW_Cycle_Stats>> hw_buffer_list;
-        std::vector<std::vector<HW_Cycle_Stats>>::iterator hw_buffer;
+        // One record per cycle, the cycle stats followed by the in-use count of
+        // each functional unit, streamed to the output directory
+        std::unique_ptr<CycleTraceWriter> cycle_trace;
+        std::vector<int32_t> cycle_record;
+        size_t fu_offset;
 
         // Make Into SimObjects to pass from config.yml
         bool cycle_tracking = false;
         bool dbg;
-        int statBufferSize;
-        int statBufferPreDefine;
-
-
-        // Class Only
-        int current_buffer_index = 0;
-
+        std::string trace_file;
+        size_t trace_buffer_records;
+        bool trace_compress;
+
+        struct HWStatisticsStats : public statistics::Group
+        {
+            HWStatisticsStats(HWStatistics &hw_statistics);
+            /** Per cycle records streamed to the cycle trace */
+            statistics::Value cycleRecords;
+            /** Records that waited for the trace writer to free a ring slot */
+            statistics::Value cycleTraceStalls;
+        } stats;
 
     public:
         HWStatistics();
         HWStatistics(const HWStatisticsParams &params);
+        ~HWStatistics();
         bool use_cycle_tracking() { return cycle_tracking; }
 
         void print();
         void simpleStats();
         void unitCorrections();
+        // Opens the cycle trace. Called once the functional units are known
+        void startCycleTrace(const std::vector<std::string> &fu_aliases);
+        void closeCycleTrace();
         void updateHWStatsCycleStart();
+        void addCycleStats(const HW_Cycle_Stats &function_stats);
+        void setFunctionalUnitUsage(size_t unit, uint64_t in_use) {
+            cycle_record[fu_offset + unit] = in_use;
+        }
         void updateHWStatsCycleEnd(int curr_cycle);
-        void updateBuffer();
         void clearStats();
 };
 
@@ -7,6 +7,10 @@ class HWStatistics(SimObject):
     type = 'HWStatistics'
     # gem5-SALAM attached header
     cxx_header = "hwacc/HWModeling/src/hw_statistics.hh"
+    cycle_tracking = Param.Bool(False, "Stream per cycle runtime statistics to a binary trace")
+    cycle_trace_file = Param.String("", "Cycle trace file in the output directory, defaults to <name>.cycles.bin")
+    cycle_trace_buffer = Param.Unsigned(65536, "Cycle records buffered for the trace writer thread")
+    cycle_trace_compress = Param.Bool(False, "Gzip compress the cycle trace")
     ### --- Do Not Modify Below This Line --- ###
     ### Templates
     ### YML Type: statistics
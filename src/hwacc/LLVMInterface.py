@@ -1,6 +1,6 @@
 from m5.params import *
 from m5.proxy import *
-from m5.SimObject import SimObject
+from m5.SimObject import SimObject, PyBindMethod
 from m5.objects.ComputeUnit import ComputeUnit
 
 class LLVMInterface(ComputeUnit):
@@ -11,4 +11,28 @@ class LLVMInterface(ComputeUnit):
     lockstep_mode = Param.Bool(True, "TRUE: Stall datapath if any operation stalls. FALSE: Only stall datapath regions with stalls")
     sched_threshold = Param.UInt32(10000, "Scheduling window threshold. Prevents scheduling windows size from exploding during regions of high loop parallelism")
     clock_period = Param.Int32(10, "System clock speed")
-    top_name = Param.String("top", "Name of the top-level function for the accelerator")
\ No newline at end of file
+    top_name = Param.String("top", "Name of the top-level function for the accelerator")
+    store_forwarding = Param.Bool(False, "Forward data from in-flight stores to loads fully covered by them")
+    memory_order = Param.String("relaxed", "Memory ordering policy. relaxed: only in-flight accesses are checked for hazards, so "
+        "an access may issue ahead of an older access to the same address that has not issued yet. tso: loads issue in program "
+        "order and wait for older unissued stores to the same bytes, and stores wait for every older access to issue. "
+        "strict: all accesses issue in program order")
+    ir_cache_dir = Param.String("", "Directory holding pre-parsed bitcode of the IR file keyed by its hash. Empty disables the cache")
+    function_instance_limits = VectorParam.String([], "Concurrent instances allowed per function as name:limit. Functions not listed run one instance at a time")
+    pipeline_loops = VectorParam.String([], "Loops to pipeline as function:header_block:ii[:max_overlap]. Loops carrying "
+        "llvm.loop.pipeline.initiationinterval metadata are pipelined as well")
+    pipeline_max_overlap = Param.Unsigned(2, "Iterations of a pipelined loop allowed in flight when the loop does not set its own limit")
+    functional_invocations = Param.Int(0, "Invocations executed functionally, in program order and without timing, before "
+        "switching to detailed timing. Negative values stay functional until switchToTiming() is called from the config")
+    jit_compute = Param.Bool(False, "JIT-compile the pure dataflow of each basic block with LLVM ORC and evaluate "
+        "arithmetic, compares, casts, selects and GEPs natively. Cycle accounting is unchanged")
+    sampling_period = Param.Unsigned(0, "Iterations per sampling period of each sampled loop. Every period simulates "
+        "sample_warmup and then sample_size iterations in detail and fast-forwards the rest functionally. 0 disables sampling")
+    sample_warmup = Param.Unsigned(1, "Detailed iterations warming the datapath and memory state before each sampling unit")
+    sample_size = Param.Unsigned(8, "Detailed iterations measured by each sampling unit")
+    sampled_loops = VectorParam.String([], "Loops to sample as function:header_block. Empty samples every innermost loop")
+
+    cxx_exports = [
+        PyBindMethod("switchToTiming"),
+        PyBindMethod("switchToFunctional"),
+    ]
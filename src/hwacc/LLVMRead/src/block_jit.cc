@@ -0,0 +1,253 @@
+#include "block_jit.hh"
+#include "base/logging.hh"
+#include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
+#include "llvm/ExecutionEngine/Orc/ThreadSafeModule.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/GetElementPtrTypeIterator.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/TargetSelect.h"
+
+#include <string>
+
+namespace SALAM
+{
+namespace
+{
+// Types of the JIT module. Pointers are 64-bit addresses, as in the
+// registers, and live in integers
+llvm::Type *
+jitType(llvm::Type * T, llvm::LLVMContext &context)
+{
+    if (T->isPointerTy()) return llvm::Type::getInt64Ty(context);
+    if (T->isIntegerTy()) return llvm::IntegerType::get(context, T->getIntegerBitWidth());
+    if (T->isFloatTy()) return llvm::Type::getFloatTy(context);
+    if (T->isDoubleTy()) return llvm::Type::getDoubleTy(context);
+    return nullptr;
+}
+
+bool
+isScalar(llvm::Type * T)
+{
+    return T->isPointerTy() || T->isFloatTy() || T->isDoubleTy()
+        || (T->isIntegerTy() && (T->getIntegerBitWidth() <= 64));
+}
+
+// Raw register bits to and from values of the JIT module
+llvm::Value *
+fromBits(llvm::IRBuilder<> &builder, llvm::Value * bits, llvm::Type * T)
+{
+    if (T->isIntegerTy(64)) return bits;
+    if (T->isIntegerTy()) return builder.CreateTrunc(bits, T);
+    if (T->isFloatTy()) return builder.CreateBitCast(builder.CreateTrunc(bits, builder.getInt32Ty()), T);
+    return builder.CreateBitCast(bits, T);
+}
+
+llvm::Value *
+toBits(llvm::IRBuilder<> &builder, llvm::Value * val)
+{
+    llvm::Type * T = val->getType();
+    if (T->isIntegerTy()) return builder.CreateZExtOrTrunc(val, builder.getInt64Ty());
+    if (T->isFloatTy()) return builder.CreateZExt(builder.CreateBitCast(val, builder.getInt32Ty()), builder.getInt64Ty());
+    return builder.CreateBitCast(val, builder.getInt64Ty());
+}
+
+llvm::Value *
+operand(llvm::IRBuilder<> &builder, llvm::Value * ops, llvm::Instruction * inst, unsigned i)
+{
+    llvm::LLVMContext &context = builder.getContext();
+    llvm::Value * op = inst->getOperand(i);
+    llvm::Type * T = jitType(op->getType(), context);
+    if (auto con = llvm::dyn_cast<llvm::ConstantInt>(op)) return llvm::ConstantInt::get(context, con->getValue());
+    if (auto con = llvm::dyn_cast<llvm::ConstantFP>(op)) return llvm::ConstantFP::get(context, con->getValueAPF());
+    if (llvm::isa<llvm::ConstantPointerNull>(op) || llvm::isa<llvm::UndefValue>(op)) return llvm::Constant::getNullValue(T);
+    llvm::Value * slot = builder.CreateConstInBoundsGEP1_64(builder.getInt64Ty(), ops, i);
+    return fromBits(builder, builder.CreateLoad(builder.getInt64Ty(), slot), T);
+}
+
+// Division by zero and shifts of the bit width or more read as in the
+// compute kernels, so the host never traps on undefined operations
+llvm::Value *
+binaryOp(llvm::IRBuilder<> &builder, llvm::BinaryOperator * inst, llvm::Value * a, llvm::Value * b)
+{
+    llvm::Type * T = a->getType();
+    llvm::Value * zero = llvm::Constant::getNullValue(T);
+    llvm::Value * one = llvm::ConstantInt::get(T, 1);
+    llvm::Value * minusOne = llvm::Constant::getAllOnesValue(T);
+    switch (inst->getOpcode()) {
+        case llvm::Instruction::UDiv:
+        case llvm::Instruction::URem: {
+            llvm::Value * byZero = builder.CreateICmpEQ(b, zero);
+            llvm::Value * result = builder.CreateBinOp(inst->getOpcode(), a, builder.CreateSelect(byZero, one, b));
+            return builder.CreateSelect(byZero, zero, result);
+        }
+        case llvm::Instruction::SDiv:
+        case llvm::Instruction::SRem: {
+            llvm::Value * byZero = builder.CreateICmpEQ(b, zero);
+            llvm::Value * byMinusOne = builder.CreateICmpEQ(b, minusOne);
+            llvm::Value * unsafe = builder.CreateOr(byZero, byMinusOne);
+            llvm::Value * result = builder.CreateBinOp(inst->getOpcode(), a, builder.CreateSelect(unsafe, one, b));
+            if (inst->getOpcode() == llvm::Instruction::SRem)
+                return builder.CreateSelect(unsafe, zero, result);
+            result = builder.CreateSelect(byMinusOne, builder.CreateSub(zero, a), result);
+            return builder.CreateSelect(byZero, zero, result);
+        }
+        case llvm::Instruction::Shl:
+        case llvm::Instruction::LShr:
+        case llvm::Instruction::AShr: {
+            unsigned bits = T->getIntegerBitWidth();
+            llvm::Value * width = llvm::ConstantInt::get(T, bits);
+            llvm::Value * tooWide = builder.CreateICmpUGE(b, width);
+            llvm::Value * result = builder.CreateBinOp(inst->getOpcode(), a, builder.CreateSelect(tooWide, zero, b));
+            llvm::Value * spill = zero;
+            if (inst->getOpcode() == llvm::Instruction::AShr)
+                spill = builder.CreateAShr(a, llvm::ConstantInt::get(T, bits - 1));
+            return builder.CreateSelect(tooWide, spill, result);
+        }
+        default:
+            return builder.CreateBinOp(inst->getOpcode(), a, b);
+    }
+}
+
+// Address arithmetic of a GEP, as laid out by the module of the IR
+llvm::Value *
+gepAddress(llvm::IRBuilder<> &builder, llvm::Value * ops, llvm::GetElementPtrInst * gep)
+{
+    const llvm::DataLayout &layout = gep->getModule()->getDataLayout();
+    llvm::Value * address = operand(builder, ops, gep, 0);
+    unsigned i = 1;
+    for (auto GTI = llvm::gep_type_begin(gep), GTE = llvm::gep_type_end(gep); GTI != GTE; ++GTI, ++i) {
+        if (llvm::StructType * STy = GTI.getStructTypeOrNull()) {
+            unsigned field = llvm::cast<llvm::ConstantInt>(GTI.getOperand())->getZExtValue();
+            uint64_t offset = layout.getStructLayout(STy)->getElementOffset(field);
+            address = builder.CreateAdd(address, builder.getInt64(offset));
+        } else {
+            uint64_t size = layout.getTypeAllocSize(GTI.getIndexedType());
+            llvm::Value * index = builder.CreateSExtOrTrunc(operand(builder, ops, gep, i), builder.getInt64Ty());
+            address = builder.CreateAdd(address, builder.CreateMul(index, builder.getInt64(size)));
+        }
+    }
+    return address;
+}
+
+llvm::Value *
+emitValue(llvm::IRBuilder<> &builder, llvm::Value * ops, llvm::Instruction * inst)
+{
+    llvm::Type * T = jitType(inst->getType(), builder.getContext());
+    if (auto binop = llvm::dyn_cast<llvm::BinaryOperator>(inst))
+        return binaryOp(builder, binop, operand(builder, ops, inst, 0), operand(builder, ops, inst, 1));
+    if (auto cmp = llvm::dyn_cast<llvm::ICmpInst>(inst))
+        return builder.CreateICmp(cmp->getPredicate(), operand(builder, ops, inst, 0), operand(builder, ops, inst, 1));
+    if (auto cmp = llvm::dyn_cast<llvm::FCmpInst>(inst))
+        return builder.CreateFCmp(cmp->getPredicate(), operand(builder, ops, inst, 0), operand(builder, ops, inst, 1));
+    if (llvm::isa<llvm::SelectInst>(inst))
+        return builder.CreateSelect(operand(builder, ops, inst, 0), operand(builder, ops, inst, 1), operand(builder, ops, inst, 2));
+    if (auto gep = llvm::dyn_cast<llvm::GetElementPtrInst>(inst))
+        return gepAddress(builder, ops, gep);
+    llvm::Value * src = operand(builder, ops, inst, 0);
+    switch (inst->getOpcode()) {
+        // Converted through 64 bits and truncated, as the compute kernels do
+        case llvm::Instruction::FPToUI: return builder.CreateTrunc(builder.CreateFPToUI(src, builder.getInt64Ty()), T);
+        case llvm::Instruction::FPToSI: return builder.CreateTrunc(builder.CreateFPToSI(src, builder.getInt64Ty()), T);
+        case llvm::Instruction::PtrToInt:
+        case llvm::Instruction::IntToPtr: return builder.CreateZExtOrTrunc(src, T);
+        default: return builder.CreateCast(llvm::cast<llvm::CastInst>(inst)->getOpcode(), src, T);
+    }
+}
+} // anonymous namespace
+
+std::unique_ptr<BlockJIT>
+BlockJIT::create()
+{
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    auto engine = llvm::orc::LLJITBuilder().create();
+    if (!engine) {
+        warn("Unable to create the block JIT: %s\n", llvm::toString(engine.takeError()));
+        return nullptr;
+    }
+    // frem lowers to fmod, resolved from the simulator itself
+    auto process = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+        (*engine)->getDataLayout().getGlobalPrefix());
+    if (!process) {
+        warn("Unable to create the block JIT: %s\n", llvm::toString(process.takeError()));
+        return nullptr;
+    }
+    (*engine)->getMainJITDylib().addGenerator(std::move(*process));
+    return std::unique_ptr<BlockJIT>(new BlockJIT(std::move(*engine)));
+}
+
+bool
+BlockJIT::isCompilable(llvm::Instruction * inst)
+{
+    switch (inst->getOpcode()) {
+        case llvm::Instruction::Add: case llvm::Instruction::Sub:
+        case llvm::Instruction::Mul: case llvm::Instruction::UDiv:
+        case llvm::Instruction::SDiv: case llvm::Instruction::URem:
+        case llvm::Instruction::SRem: case llvm::Instruction::Shl:
+        case llvm::Instruction::LShr: case llvm::Instruction::AShr:
+        case llvm::Instruction::And: case llvm::Instruction::Or:
+        case llvm::Instruction::Xor: case llvm::Instruction::FAdd:
+        case llvm::Instruction::FSub: case llvm::Instruction::FMul:
+        case llvm::Instruction::FDiv: case llvm::Instruction::FRem:
+        case llvm::Instruction::Trunc: case llvm::Instruction::ZExt:
+        case llvm::Instruction::SExt: case llvm::Instruction::FPTrunc:
+        case llvm::Instruction::FPExt: case llvm::Instruction::FPToUI:
+        case llvm::Instruction::FPToSI: case llvm::Instruction::UIToFP:
+        case llvm::Instruction::SIToFP: case llvm::Instruction::PtrToInt:
+        case llvm::Instruction::IntToPtr: case llvm::Instruction::ICmp:
+        case llvm::Instruction::FCmp: case llvm::Instruction::Select:
+        case llvm::Instruction::GetElementPtr:
+            break;
+        default:
+            return false;
+    }
+    if (inst->getNumOperands() > maxOperands) return false;
+    if (!isScalar(inst->getType())) return false;
+    for (auto const op : inst->operand_values())
+        if (!isScalar(op->getType())) return false;
+    return true;
+}
+
+std::vector<std::pair<llvm::Instruction *, JITKernel>>
+BlockJIT::compileBlock(llvm::BasicBlock * bb)
+{
+    std::vector<std::pair<llvm::Instruction *, JITKernel>> compiled;
+    std::vector<llvm::Instruction *> slice;
+    for (auto &inst : *bb) {
+        if (isCompilable(&inst)) slice.push_back(&inst);
+    }
+    if (slice.empty()) return compiled;
+
+    std::string prefix = "salam_bb" + std::to_string(blocks++) + "_";
+    auto context = std::make_unique<llvm::LLVMContext>();
+    auto module = std::make_unique<llvm::Module>(prefix, *context);
+    module->setDataLayout(jit->getDataLayout());
+    llvm::IRBuilder<> builder(*context);
+    llvm::FunctionType * kernelTy = llvm::FunctionType::get(builder.getInt64Ty(),
+        { llvm::Type::getInt64PtrTy(*context) }, false);
+    for (size_t n = 0; n < slice.size(); n++) {
+        llvm::Function * kernel = llvm::Function::Create(kernelTy, llvm::Function::ExternalLinkage,
+            prefix + std::to_string(n), module.get());
+        builder.SetInsertPoint(llvm::BasicBlock::Create(*context, "entry", kernel));
+        builder.CreateRet(toBits(builder, emitValue(builder, kernel->getArg(0), slice[n])));
+    }
+
+    if (auto err = jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context)))) {
+        warn("Unable to JIT basic block %s: %s\n", bb->getName().str(), llvm::toString(std::move(err)));
+        return compiled;
+    }
+    for (size_t n = 0; n < slice.size(); n++) {
+        auto symbol = jit->lookup(prefix + std::to_string(n));
+        if (!symbol) {
+            warn("Unable to JIT %s: %s\n", bb->getName().str(), llvm::toString(symbol.takeError()));
+            continue;
+        }
+        compiled.push_back({slice[n], (JITKernel)symbol->getAddress()});
+    }
+    kernels += compiled.size();
+    return compiled;
+}
+}
@@ -0,0 +1,52 @@
+#ifndef __HWACC_BLOCK_JIT_HH__
+#define __HWACC_BLOCK_JIT_HH__
+//------------------------------------------//
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Instruction.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace SALAM
+{
+/*****************************************************************************
+* A JIT kernel evaluates one instruction of the pure dataflow slice of a
+* basic block natively. It reads the raw bits of every operand from ops, in
+* IR operand order, and returns the raw bits of the result. Constant operands
+* are folded into the native code and their entries are ignored.
+*****************************************************************************/
+typedef uint64_t (*JITKernel)(const uint64_t * ops);
+
+/*****************************************************************************
+* BlockJIT compiles the pure dataflow slice of basic blocks with LLVM ORC.
+* The slice is every scalar arithmetic, compare, cast, select and GEP of the
+* block; loads, stores, calls, phis and terminators stay interpreted. Each
+* block becomes one module with a kernel per sliced instruction, so the
+* timing model still issues, schedules and commits every node on its own.
+*****************************************************************************/
+class BlockJIT
+{
+    private:
+        std::unique_ptr<llvm::orc::LLJIT> jit;
+        uint64_t blocks = 0;
+        uint64_t kernels = 0;
+        BlockJIT(std::unique_ptr<llvm::orc::LLJIT> engine) : jit(std::move(engine)) { }
+
+    public:
+        static constexpr unsigned maxOperands = 16;
+        // Returns nullptr when the host has no usable JIT target
+        static std::unique_ptr<BlockJIT> create();
+        static bool isCompilable(llvm::Instruction * inst);
+        // Compiles the slice of bb and returns the kernel of each sliced
+        // instruction. Instructions that failed to compile are left out
+        std::vector<std::pair<llvm::Instruction *, JITKernel>> compileBlock(llvm::BasicBlock * bb);
+        uint64_t compiledBlocks() const { return blocks; }
+        uint64_t compiledKernels() const { return kernels; }
+};
+}
+
+//------------------------------------------//
+#endif //__HWACC_BLOCK_JIT_HH__
@@ -0,0 +1,365 @@
+#include "compute_kernels.hh"
+#include "llvm/IR/Instructions.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace SALAM
+{
+namespace
+{
+// Views of the low Bits bits of a raw value
+template <unsigned Bits>
+inline uint64_t
+zext(uint64_t x)
+{
+    if constexpr (Bits >= 64) return x;
+    else return x & ((1ULL << Bits) - 1);
+}
+
+template <unsigned Bits>
+inline int64_t
+sext(uint64_t x)
+{
+    if constexpr (Bits >= 64) return (int64_t)x;
+    else return ((int64_t)(x << (64 - Bits))) >> (64 - Bits);
+}
+
+template <typename T>
+inline T
+fpValue(uint64_t x)
+{
+    T val;
+    std::memcpy(&val, &x, sizeof(T));
+    return val;
+}
+
+template <typename T>
+inline uint64_t
+fpBits(T val)
+{
+    uint64_t x = 0;
+    std::memcpy(&x, &val, sizeof(T));
+    return x;
+}
+
+//--------- Integer operations, templated on the bit width ------------------//
+template <unsigned Bits> struct IntAdd {
+    static uint64_t run(uint64_t a, uint64_t b) { return zext<Bits>(a + b); }
+};
+template <unsigned Bits> struct IntSub {
+    static uint64_t run(uint64_t a, uint64_t b) { return zext<Bits>(a - b); }
+};
+template <unsigned Bits> struct IntMul {
+    static uint64_t run(uint64_t a, uint64_t b) { return zext<Bits>(a * b); }
+};
+template <unsigned Bits> struct IntAnd {
+    static uint64_t run(uint64_t a, uint64_t b) { return zext<Bits>(a & b); }
+};
+template <unsigned Bits> struct IntOr {
+    static uint64_t run(uint64_t a, uint64_t b) { return zext<Bits>(a | b); }
+};
+template <unsigned Bits> struct IntXor {
+    static uint64_t run(uint64_t a, uint64_t b) { return zext<Bits>(a ^ b); }
+};
+// Division by zero is undefined in the IR. It reads as zero, as in the
+// lane-wise kernels. Dividing by -1 is handled apart so the most negative
+// value does not trap the host
+template <unsigned Bits> struct IntUDiv {
+    static uint64_t run(uint64_t a, uint64_t b) {
+        return zext<Bits>(b) ? (zext<Bits>(a) / zext<Bits>(b)) : 0;
+    }
+};
+template <unsigned Bits> struct IntURem {
+    static uint64_t run(uint64_t a, uint64_t b) {
+        return zext<Bits>(b) ? (zext<Bits>(a) % zext<Bits>(b)) : 0;
+    }
+};
+template <unsigned Bits> struct IntSDiv {
+    static uint64_t run(uint64_t a, uint64_t b) {
+        int64_t x = sext<Bits>(a);
+        int64_t y = sext<Bits>(b);
+        if (y == -1) return zext<Bits>(0 - (uint64_t)x);
+        return y ? zext<Bits>((uint64_t)(x / y)) : 0;
+    }
+};
+template <unsigned Bits> struct IntSRem {
+    static uint64_t run(uint64_t a, uint64_t b) {
+        int64_t x = sext<Bits>(a);
+        int64_t y = sext<Bits>(b);
+        if ((y == 0) || (y == -1)) return 0;
+        return zext<Bits>((uint64_t)(x % y));
+    }
+};
+// Shift amounts of the bit width or more are poison in the IR
+template <unsigned Bits> struct IntShl {
+    static uint64_t run(uint64_t a, uint64_t b) {
+        b = zext<Bits>(b);
+        return (b < Bits) ? zext<Bits>(a << b) : 0;
+    }
+};
+template <unsigned Bits> struct IntLShr {
+    static uint64_t run(uint64_t a, uint64_t b) {
+        b = zext<Bits>(b);
+        return (b < Bits) ? (zext<Bits>(a) >> b) : 0;
+    }
+};
+template <unsigned Bits> struct IntAShr {
+    static uint64_t run(uint64_t a, uint64_t b) {
+        b = zext<Bits>(b);
+        return zext<Bits>((uint64_t)(sext<Bits>(a) >> ((b < Bits) ? b : (Bits - 1))));
+    }
+};
+// Trunc keeps the low bits of the destination width, zext the low bits of
+// the source width. The result register only stores the destination bytes
+template <unsigned Bits> struct IntLow {
+    static uint64_t run(uint64_t a, uint64_t b) { return zext<Bits>(a); }
+};
+template <unsigned Bits> struct IntSExt {
+    static uint64_t run(uint64_t a, uint64_t b) { return (uint64_t)sext<Bits>(a); }
+};
+
+//--------- Floating point operations, templated on the host type ----------//
+template <typename T> struct FPAdd {
+    static uint64_t run(uint64_t a, uint64_t b) { return fpBits<T>(fpValue<T>(a) + fpValue<T>(b)); }
+};
+template <typename T> struct FPSub {
+    static uint64_t run(uint64_t a, uint64_t b) { return fpBits<T>(fpValue<T>(a) - fpValue<T>(b)); }
+};
+template <typename T> struct FPMul {
+    static uint64_t run(uint64_t a, uint64_t b) { return fpBits<T>(fpValue<T>(a) * fpValue<T>(b)); }
+};
+template <typename T> struct FPDiv {
+    static uint64_t run(uint64_t a, uint64_t b) { return fpBits<T>(fpValue<T>(a) / fpValue<T>(b)); }
+};
+template <typename T> struct FPRem {
+    static uint64_t run(uint64_t a, uint64_t b) { return fpBits<T>(std::fmod(fpValue<T>(a), fpValue<T>(b))); }
+};
+template <typename T> struct FPToUI {
+    static uint64_t run(uint64_t a, uint64_t b) { return (uint64_t)fpValue<T>(a); }
+};
+template <typename T> struct FPToSI {
+    static uint64_t run(uint64_t a, uint64_t b) { return (uint64_t)(int64_t)fpValue<T>(a); }
+};
+template <typename T> struct IntToFP {
+    template <unsigned Bits> struct Unsigned {
+        static uint64_t run(uint64_t a, uint64_t b) { return fpBits<T>((T)zext<Bits>(a)); }
+    };
+    template <unsigned Bits> struct Signed {
+        static uint64_t run(uint64_t a, uint64_t b) { return fpBits<T>((T)sext<Bits>(a)); }
+    };
+};
+
+uint64_t
+fpTrunc(uint64_t a, uint64_t b)
+{
+    return fpBits<float>((float)fpValue<double>(a));
+}
+
+uint64_t
+fpExt(uint64_t a, uint64_t b)
+{
+    return fpBits<double>((double)fpValue<float>(a));
+}
+
+// Pointer casts and bitcasts between scalars keep the bits as they are
+uint64_t
+identity(uint64_t a, uint64_t b)
+{
+    return a;
+}
+
+//--------- Comparisons, templated on the predicate -------------------------//
+template <llvm::CmpInst::Predicate P> struct IntCmp {
+    template <unsigned Bits> struct At {
+        static uint64_t run(uint64_t a, uint64_t b) {
+            uint64_t x = zext<Bits>(a);
+            uint64_t y = zext<Bits>(b);
+            if constexpr (P == llvm::CmpInst::ICMP_EQ) return x == y;
+            else if constexpr (P == llvm::CmpInst::ICMP_NE) return x != y;
+            else if constexpr (P == llvm::CmpInst::ICMP_UGT) return x > y;
+            else if constexpr (P == llvm::CmpInst::ICMP_UGE) return x >= y;
+            else if constexpr (P == llvm::CmpInst::ICMP_ULT) return x < y;
+            else if constexpr (P == llvm::CmpInst::ICMP_ULE) return x <= y;
+            else if constexpr (P == llvm::CmpInst::ICMP_SGT) return sext<Bits>(a) > sext<Bits>(b);
+            else if constexpr (P == llvm::CmpInst::ICMP_SGE) return sext<Bits>(a) >= sext<Bits>(b);
+            else if constexpr (P == llvm::CmpInst::ICMP_SLT) return sext<Bits>(a) < sext<Bits>(b);
+            else return sext<Bits>(a) <= sext<Bits>(b);
+        }
+    };
+};
+
+template <llvm::CmpInst::Predicate P> struct FPCmp {
+    template <typename T> struct Of {
+        static uint64_t run(uint64_t a, uint64_t b) {
+            T x = fpValue<T>(a);
+            T y = fpValue<T>(b);
+            bool unordered = std::isnan(x) || std::isnan(y);
+            if constexpr (P == llvm::CmpInst::FCMP_FALSE) return false;
+            else if constexpr (P == llvm::CmpInst::FCMP_OEQ) return !unordered && (x == y);
+            else if constexpr (P == llvm::CmpInst::FCMP_OGT) return !unordered && (x > y);
+            else if constexpr (P == llvm::CmpInst::FCMP_OGE) return !unordered && (x >= y);
+            else if constexpr (P == llvm::CmpInst::FCMP_OLT) return !unordered && (x < y);
+            else if constexpr (P == llvm::CmpInst::FCMP_OLE) return !unordered && (x <= y);
+            else if constexpr (P == llvm::CmpInst::FCMP_ONE) return !unordered && (x != y);
+            else if constexpr (P == llvm::CmpInst::FCMP_ORD) return !unordered;
+            else if constexpr (P == llvm::CmpInst::FCMP_UNO) return unordered;
+            else if constexpr (P == llvm::CmpInst::FCMP_UEQ) return unordered || (x == y);
+            else if constexpr (P == llvm::CmpInst::FCMP_UGT) return unordered || (x > y);
+            else if constexpr (P == llvm::CmpInst::FCMP_UGE) return unordered || (x >= y);
+            else if constexpr (P == llvm::CmpInst::FCMP_ULT) return unordered || (x < y);
+            else if constexpr (P == llvm::CmpInst::FCMP_ULE) return unordered || (x <= y);
+            else if constexpr (P == llvm::CmpInst::FCMP_UNE) return unordered || (x != y);
+            else return true;
+        }
+    };
+};
+
+//--------- Kernel tables ---------------------------------------------------//
+// Integer widths with a kernel. Other widths are evaluated by compute()
+template <template <unsigned> class K>
+ComputeKernel
+byWidth(unsigned bits)
+{
+    switch (bits) {
+        case 1: return K<1>::run;
+        case 8: return K<8>::run;
+        case 16: return K<16>::run;
+        case 32: return K<32>::run;
+        case 64: return K<64>::run;
+        default: return nullptr;
+    }
+}
+
+template <template <typename> class K>
+ComputeKernel
+byFPType(llvm::Type * T)
+{
+    if (T->isFloatTy()) return K<float>::run;
+    if (T->isDoubleTy()) return K<double>::run;
+    return nullptr;
+}
+
+// Pointers are 64 bits wide, as in SALAM::Value
+unsigned
+intBits(llvm::Type * T)
+{
+    if (T->isPointerTy()) return 64;
+    if (T->isIntegerTy()) return T->getIntegerBitWidth();
+    return 0;
+}
+
+template <llvm::CmpInst::Predicate P>
+ComputeKernel
+icmpAt(unsigned bits)
+{
+    return byWidth<IntCmp<P>::template At>(bits);
+}
+
+template <llvm::CmpInst::Predicate P>
+ComputeKernel
+fcmpOf(llvm::Type * T)
+{
+    return byFPType<FPCmp<P>::template Of>(T);
+}
+
+ComputeKernel
+icmpKernel(llvm::CmpInst::Predicate pred, unsigned bits)
+{
+    switch (pred) {
+        case llvm::CmpInst::ICMP_EQ: return icmpAt<llvm::CmpInst::ICMP_EQ>(bits);
+        case llvm::CmpInst::ICMP_NE: return icmpAt<llvm::CmpInst::ICMP_NE>(bits);
+        case llvm::CmpInst::ICMP_UGT: return icmpAt<llvm::CmpInst::ICMP_UGT>(bits);
+        case llvm::CmpInst::ICMP_UGE: return icmpAt<llvm::CmpInst::ICMP_UGE>(bits);
+        case llvm::CmpInst::ICMP_ULT: return icmpAt<llvm::CmpInst::ICMP_ULT>(bits);
+        case llvm::CmpInst::ICMP_ULE: return icmpAt<llvm::CmpInst::ICMP_ULE>(bits);
+        case llvm::CmpInst::ICMP_SGT: return icmpAt<llvm::CmpInst::ICMP_SGT>(bits);
+        case llvm::CmpInst::ICMP_SGE: return icmpAt<llvm::CmpInst::ICMP_SGE>(bits);
+        case llvm::CmpInst::ICMP_SLT: return icmpAt<llvm::CmpInst::ICMP_SLT>(bits);
+        case llvm::CmpInst::ICMP_SLE: return icmpAt<llvm::CmpInst::ICMP_SLE>(bits);
+        default: return nullptr;
+    }
+}
+
+ComputeKernel
+fcmpKernel(llvm::CmpInst::Predicate pred, llvm::Type * T)
+{
+    switch (pred) {
+        case llvm::CmpInst::FCMP_FALSE: return fcmpOf<llvm::CmpInst::FCMP_FALSE>(T);
+        case llvm::CmpInst::FCMP_OEQ: return fcmpOf<llvm::CmpInst::FCMP_OEQ>(T);
+        case llvm::CmpInst::FCMP_OGT: return fcmpOf<llvm::CmpInst::FCMP_OGT>(T);
+        case llvm::CmpInst::FCMP_OGE: return fcmpOf<llvm::CmpInst::FCMP_OGE>(T);
+        case llvm::CmpInst::FCMP_OLT: return fcmpOf<llvm::CmpInst::FCMP_OLT>(T);
+        case llvm::CmpInst::FCMP_OLE: return fcmpOf<llvm::CmpInst::FCMP_OLE>(T);
+        case llvm::CmpInst::FCMP_ONE: return fcmpOf<llvm::CmpInst::FCMP_ONE>(T);
+        case llvm::CmpInst::FCMP_ORD: return fcmpOf<llvm::CmpInst::FCMP_ORD>(T);
+        case llvm::CmpInst::FCMP_UNO: return fcmpOf<llvm::CmpInst::FCMP_UNO>(T);
+        case llvm::CmpInst::FCMP_UEQ: return fcmpOf<llvm::CmpInst::FCMP_UEQ>(T);
+        case llvm::CmpInst::FCMP_UGT: return fcmpOf<llvm::CmpInst::FCMP_UGT>(T);
+        case llvm::CmpInst::FCMP_UGE: return fcmpOf<llvm::CmpInst::FCMP_UGE>(T);
+        case llvm::CmpInst::FCMP_ULT: return fcmpOf<llvm::CmpInst::FCMP_ULT>(T);
+        case llvm::CmpInst::FCMP_ULE: return fcmpOf<llvm::CmpInst::FCMP_ULE>(T);
+        case llvm::CmpInst::FCMP_UNE: return fcmpOf<llvm::CmpInst::FCMP_UNE>(T);
+        case llvm::CmpInst::FCMP_TRUE: return fcmpOf<llvm::CmpInst::FCMP_TRUE>(T);
+        default: return nullptr;
+    }
+}
+} // anonymous namespace
+
+ComputeKernel
+selectComputeKernel(llvm::Instruction * inst)
+{
+    if (inst->getNumOperands() == 0) return nullptr;
+    llvm::Type * T = inst->getType();
+    llvm::Type * srcT = inst->getOperand(0)->getType();
+    // Vectors are evaluated lane by lane, aggregates by compute()
+    if (!T->isSingleValueType() || T->isVectorTy() || srcT->isVectorTy()) return nullptr;
+    switch (inst->getOpcode()) {
+        case llvm::Instruction::Add: return byWidth<IntAdd>(intBits(T));
+        case llvm::Instruction::Sub: return byWidth<IntSub>(intBits(T));
+        case llvm::Instruction::Mul: return byWidth<IntMul>(intBits(T));
+        case llvm::Instruction::UDiv: return byWidth<IntUDiv>(intBits(T));
+        case llvm::Instruction::SDiv: return byWidth<IntSDiv>(intBits(T));
+        case llvm::Instruction::URem: return byWidth<IntURem>(intBits(T));
+        case llvm::Instruction::SRem: return byWidth<IntSRem>(intBits(T));
+        case llvm::Instruction::Shl: return byWidth<IntShl>(intBits(T));
+        case llvm::Instruction::LShr: return byWidth<IntLShr>(intBits(T));
+        case llvm::Instruction::AShr: return byWidth<IntAShr>(intBits(T));
+        case llvm::Instruction::And: return byWidth<IntAnd>(intBits(T));
+        case llvm::Instruction::Or: return byWidth<IntOr>(intBits(T));
+        case llvm::Instruction::Xor: return byWidth<IntXor>(intBits(T));
+        case llvm::Instruction::FAdd: return byFPType<FPAdd>(T);
+        case llvm::Instruction::FSub: return byFPType<FPSub>(T);
+        case llvm::Instruction::FMul: return byFPType<FPMul>(T);
+        case llvm::Instruction::FDiv: return byFPType<FPDiv>(T);
+        case llvm::Instruction::FRem: return byFPType<FPRem>(T);
+        case llvm::Instruction::Trunc: return byWidth<IntLow>(intBits(T));
+        case llvm::Instruction::ZExt: return byWidth<IntLow>(intBits(srcT));
+        case llvm::Instruction::SExt: return byWidth<IntSExt>(intBits(srcT));
+        case llvm::Instruction::FPToUI: return byFPType<FPToUI>(srcT);
+        case llvm::Instruction::FPToSI: return byFPType<FPToSI>(srcT);
+        case llvm::Instruction::UIToFP:
+            if (T->isFloatTy()) return byWidth<IntToFP<float>::Unsigned>(intBits(srcT));
+            if (T->isDoubleTy()) return byWidth<IntToFP<double>::Unsigned>(intBits(srcT));
+            return nullptr;
+        case llvm::Instruction::SIToFP:
+            if (T->isFloatTy()) return byWidth<IntToFP<float>::Signed>(intBits(srcT));
+            if (T->isDoubleTy()) return byWidth<IntToFP<double>::Signed>(intBits(srcT));
+            return nullptr;
+        case llvm::Instruction::FPTrunc:
+            return (srcT->isDoubleTy() && T->isFloatTy()) ? fpTrunc : nullptr;
+        case llvm::Instruction::FPExt:
+            return (srcT->isFloatTy() && T->isDoubleTy()) ? fpExt : nullptr;
+        case llvm::Instruction::PtrToInt:
+        case llvm::Instruction::IntToPtr:
+        case llvm::Instruction::BitCast:
+            return identity;
+        case llvm::Instruction::ICmp:
+            return icmpKernel(llvm::cast<llvm::CmpInst>(inst)->getPredicate(), intBits(srcT));
+        case llvm::Instruction::FCmp:
+            return fcmpKernel(llvm::cast<llvm::CmpInst>(inst)->getPredicate(), srcT);
+        default:
+            return nullptr;
+    }
+}
+}
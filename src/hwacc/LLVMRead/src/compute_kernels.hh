@@ -0,0 +1,26 @@
+#ifndef __HWACC_COMPUTE_KERNELS_HH__
+#define __HWACC_COMPUTE_KERNELS_HH__
+//------------------------------------------//
+#include "llvm/IR/Instruction.h"
+
+#include <cstdint>
+
+namespace SALAM
+{
+/*****************************************************************************
+* A compute kernel evaluates one scalar instruction on the raw bits of its
+* locked operands and returns the raw bits of the result. Kernels are
+* specialized on the operation, the bit width and the int/float kind of the
+* static instruction when the graph is constructed, so evaluating them needs
+* no register virtuals and no switches on the type. Unary operations ignore
+* the second operand.
+*****************************************************************************/
+typedef uint64_t (*ComputeKernel)(uint64_t op1, uint64_t op2);
+
+// Returns the kernel of a scalar instruction, or nullptr when the
+// instruction is evaluated by its own compute()
+ComputeKernel selectComputeKernel(llvm::Instruction * inst);
+}
+
+//------------------------------------------//
+#endif //__HWACC_COMPUTE_KERNELS_HH__
@@ -1,5 +1,7 @@
 #include "function.hh"
 
+#include <map>
+
 using namespace SALAM;
 
 SALAM::Function::Function(uint64_t id, gem5::SimObject * owner, bool dbg) :
@@ -19,6 +21,7 @@ SALAM::Function::initialize(llvm::Value * irval,
 	//Parse irval for function params
 	llvm::Function * func = llvm::dyn_cast<llvm::Function>(irval);
 	assert(func); //panic("Invalid llvm::Value type used to initialize function. Failed cast to llvm::Function.");
+    name = func->getName().str();
     if (func->getName() == topName) top = true;
     else top = false;
 	// Fill arguments
@@ -44,4 +47,51 @@ SALAM::Function::initialize(llvm::Value * irval,
         bbList.push_back(bblock);
         bblock->initialize(&bb, vmap, valueList);
     }
-}
\ No newline at end of file
+}
+
+void
+SALAM::Function::assignRegisterSlots() {
+    // Operands of constants and arguments are locked straight from the slot,
+    // without going through the register of the referenced value. Vector and
+    // aggregate values keep using their registers
+    auto scalar = [](std::shared_ptr<SALAM::Register> reg) {
+        return reg && (reg->isInt() || reg->isFP() || reg->isPtr());
+    };
+    std::map<uint64_t, uint64_t> slots;
+    registerImage.clear();
+    argumentSlots.assign(arguments.size(), StaticInstruction::noSlot);
+    for (size_t i = 0; i < arguments.size(); i++) {
+        if (!scalar(arguments.at(i)->getReg())) continue;
+        argumentSlots.at(i) = registerImage.size();
+        slots[arguments.at(i)->getUID()] = registerImage.size();
+        registerImage.push_back(0);
+    }
+    for (auto bb : bbList) {
+        for (auto inst : *(bb->Instructions())) {
+            // Phi dependencies include the incoming blocks, which never get a slot
+            auto deps = inst->Instruction::getStaticDependencies();
+            std::vector<uint64_t> operandSlots(deps.size(), StaticInstruction::noSlot);
+            for (size_t i = 0; i < deps.size(); i++) {
+                if (!deps.at(i)->isConstant() && !deps.at(i)->isArgument()) continue;
+                if (!scalar(deps.at(i)->getReg())) continue;
+                auto it = slots.find(deps.at(i)->getUID());
+                if (it == slots.end()) {
+                    assert(deps.at(i)->isConstant());
+                    it = slots.insert({deps.at(i)->getUID(), registerImage.size()}).first;
+                    registerImage.push_back(deps.at(i)->getReg()->getRawData(false));
+                }
+                operandSlots.at(i) = it->second;
+            }
+            inst->setOperandSlots(operandSlots);
+        }
+    }
+    if (dbg) DPRINTFS(LLVMParse, owner, "Function %s uses %d register file slots\n", name, registerImage.size());
+}
+
+void
+SALAM::Function::loadArgumentRegisters(std::vector<uint64_t> &registers) {
+    for (size_t i = 0; i < arguments.size(); i++) {
+        if (argumentSlots.at(i) != StaticInstruction::noSlot)
+            registers.at(argumentSlots.at(i)) = arguments.at(i)->getReg()->getRawData();
+    }
+}
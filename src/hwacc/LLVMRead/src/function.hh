@@ -12,8 +12,13 @@ namespace SALAM {
 		std::vector<std::shared_ptr<SALAM::BasicBlock>> bbList;
 		std::vector<std::shared_ptr<SALAM::Value>> arguments;
 		bool top;
+		std::string name;
 		unsigned activeInstances = 0;
 		unsigned instanceLimit = 1;
+		// Initial register file of an instance. Holds the scalar constants and
+		// arguments read by the function, argument slots are filled at launch
+		std::vector<uint64_t> registerImage;
+		std::vector<uint64_t> argumentSlots;
 	public:
 		Function(uint64_t id, gem5::SimObject * owner, bool dbg);
 		void initialize(llvm::Value * irval, irvmap *vmap, SALAM::valueListTy *valueList, std::string topName);
@@ -26,6 +31,16 @@ namespace SALAM {
 		void addInstance() { activeInstances++; }
 		void removeInstance() { if (activeInstances>0) activeInstances--; }
 		bool canLaunch() { return activeInstances < instanceLimit; }
+		unsigned getActiveInstances() { return activeInstances; }
+		unsigned getInstanceLimit() { return instanceLimit; }
+		void setInstanceLimit(unsigned limit) { instanceLimit = limit; }
+		// Instances of functions that may overlap need private return registers
+		bool isConcurrent() { return instanceLimit > 1; }
+		const std::string & getName() { return name; }
+		// Assigns register file slots to the operands of every instruction
+		void assignRegisterSlots();
+		const std::vector<uint64_t> & getRegisterImage() { return registerImage; }
+		void loadArgumentRegisters(std::vector<uint64_t> &registers);
 	};
 }
 
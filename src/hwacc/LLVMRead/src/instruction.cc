@@ -1,9 +1,14 @@
 #include "instruction.hh"
 #include "llvm/IR/GetElementPtrTypeIterator.h"
 #include "llvm/IR/DataLayout.h"
+#include "llvm/IR/Intrinsics.h"
 #include "sim/sim_object.hh"
 
 #include <cmath>
+#include <cstring>
+#include <map>
+#include <type_traits>
+#include <vector>
 
 namespace SALAM
 {
@@ -14,45 +19,58 @@ namespace SALAM
 
 
 SALAM::Instruction::Instruction(uint64_t id, gem5::SimObject * owner, bool dbg) :
-                         Value(id, owner, dbg)
+                         Value(id, owner, dbg),
+                         staticInst(std::make_shared<StaticInstruction>())
 {
     currentCycle = 0;
 }
 
 SALAM::Instruction::Instruction(uint64_t id, gem5::SimObject * owner, bool dbg,
                          uint64_t OpCode) :
-                         Value(id, owner, dbg),
-                         llvmOpCode(OpCode)
+                         Instruction(id, owner, dbg)
 {
-    currentCycle = 0;
+    staticInst->opcode = OpCode;
 }
 
 SALAM::Instruction::Instruction(uint64_t id, gem5::SimObject * owner, bool dbg,
                          uint64_t OpCode,
                          uint64_t cycles) :
-                         Value(id, owner, dbg),
-                         llvmOpCode(OpCode),
-                         cycleCount(cycles)
+                         Instruction(id, owner, dbg, OpCode)
 {
-    currentCycle = 0;
+    staticInst->cycles = cycles;
 }
 
 SALAM::Instruction::Instruction(uint64_t id, gem5::SimObject * owner, bool dbg,
                          uint64_t OpCode,
                          uint64_t cycles,
                          uint64_t fu) :
-                         Value(id, owner, dbg),
-                         llvmOpCode(OpCode),
-                         cycleCount(cycles),
-                         functional_unit(fu)
+                         Instruction(id, owner, dbg, OpCode, cycles)
 {
-    currentCycle = 0;
+    staticInst->functionalUnit = fu;
 }
 
 SALAM::Instruction::~Instruction()
 {
 }
 
+size_t
+SALAM::Instruction::getDynamicFootprint() const
+{
+    // Members added by subclasses are not counted
+    return sizeof(SALAM::Instruction)
+         + operands.capacity() * sizeof(SALAM::Operand)
+         + dynamicDependencies.capacity() * sizeof(uint64_t)
+         + dynamicUsers.capacity() * sizeof(std::shared_ptr<SALAM::Instruction>);
+}
+
+size_t
+SALAM::Instruction::getStaticFootprint() const
+{
+    return sizeof(StaticInstruction)
+         + staticInst->dependencies.capacity() * sizeof(std::shared_ptr<SALAM::Value>)
+         + getIRString().capacity() + getIRStub().capacity();
+}
+
 SALAM::Instruction::Instruction_Debugger::Instruction_Debugger()
 {
 }
@@ -92,19 +110,27 @@ SALAM::Instruction::initialize(llvm::Value *irval,
             opval = mapit->second;
         }
         if (dbg) DPRINTFS(LLVMParse, owner, "Link Operand to Static Operands List\n");
-        staticDependencies.push_back(opval);
+        staticInst->dependencies.push_back(opval);
         if(llvm::isa<llvm::PHINode>(inst)) {
             if (dbg) DPRINTFS(LLVMParse, owner, "Phi Node Initiated\n");
             llvm::PHINode * phi = llvm::dyn_cast<llvm::PHINode>(inst);
             llvm::Value * bb = llvm::dyn_cast<llvm::Value>(phi->getIncomingBlock(phiBB));
             mapit = irmap->find(bb);
             opval = mapit->second;
-            staticDependencies.push_back(opval);
+            staticInst->dependencies.push_back(opval);
             ++phiBB;
         } else if(llvm::isa<llvm::CmpInst>(inst)) {
             if (dbg) DPRINTFS(LLVMParse, owner, "Compare Instruction Initiated\n");
         }
     }
+    // Vector arithmetic is evaluated lane by lane
+    if (llvm::isa<llvm::BinaryOperator>(inst) && inst->getType()->isVectorTy()) {
+        staticInst->lanes = vectorLanes(inst->getType());
+        staticInst->laneWise = true;
+    }
+#if !USE_LLVM_AP_VALUES
+    staticInst->kernel = selectComputeKernel(inst);
+#endif
 }
 
 void
@@ -113,18 +139,39 @@ SALAM::Instruction::signalUsers()
     uint64_t count = 0;
     for (auto user : dynamicUsers) {
         if (dbg) DPRINTFS(Runtime, owner, "|| User[%i] =============\n", count);
-        user->setOperandValue(uid);
+        user->setOperandValue(uid, returnReg);
+        // Wake the user once its last dependency has resolved
+        if (user->readyQueue && (user->getDependencyCount() == 0))
+            user->readyQueue->insert({user->sequence, user});
         count++;
     }
+    // Users are signalled once. Dropping them releases pooled instances
+    dynamicUsers.clear();
     if (dbg) DPRINTFS(Runtime, owner, "||==signalUsers==========\n");
 }
 
+bool
+SALAM::Instruction::addRuntimeDependency(std::shared_ptr<SALAM::Instruction> dep)
+{
+    // Operands that reference the same producer share a single dependency
+    auto dep_uid = dep->getUID();
+    for (auto pending : dynamicDependencies) {
+        if (pending == dep_uid) return false;
+    }
+    dynamicDependencies.push_back(dep_uid);
+    return true;
+}
+
 void
 SALAM::Instruction::removeDynamicDependency(uint64_t opuid)
 {
-    auto end = dynamicDependencies.end();
-    auto it = dynamicDependencies.find(opuid);
-    if (it != end) dynamicDependencies.erase(it);
+    for (auto i = 0; i < dynamicDependencies.size(); i++) {
+        if (dynamicDependencies[i] == opuid) {
+            dynamicDependencies[i] = dynamicDependencies.back();
+            dynamicDependencies.pop_back();
+            return;
+        }
+    }
 }
 
 bool
@@ -145,24 +192,37 @@ SALAM::Instruction::ready()
 }
 
 bool
-SALAM::Instruction::launch()
+SALAM::Instruction::acquireFunctionalUnit()
 {
-    if (hasFunctionalUnit()) {
-        if(!hw_interface->availableFunctionalUnit(getFunctionalUnit())) {
-            return false;
-            std::cout << "Waiting on next available FU\n"; 
-        } else {
-            
-        }
+    if (!hasFunctionalUnit() || fuHeld) return true;
+    if (!staticInst->hw->availableFunctionalUnit(getFunctionalUnit(), getLanes())) {
+        if (dbg) DPRINTFS(Runtime, owner, "||  Waiting on next available FU[%i]\n", getFunctionalUnit());
+        return false;
     }
+    fuHeld = true;
+    fuRelease = staticInst->hw->getInitiationInterval(getFunctionalUnit(), getCycleCount());
+    return true;
+}
+
+void
+SALAM::Instruction::releaseFunctionalUnit()
+{
+    if (!fuHeld) return;
+    staticInst->hw->clearFunctionalUnit(getFunctionalUnit(), getLanes());
+    fuHeld = false;
+}
+
+bool
+SALAM::Instruction::launch()
+{
     launched = true;
     if (getCycleCount() == 0) { // Instruction ready to be committed
         if (dbg) DPRINTFS(Runtime, owner, "||  0 Cycle Instruction\n");
-        compute();
+        execute();
         commit();
     } else {
         currentCycle++;
-        compute();
+        execute();
     }
     if (dbg) DPRINTFS(Runtime, owner, "||==Return: %s\n", isCommitted() ? "true" : "false");
     if (dbg) DPRINTFS(Runtime, owner, "||==launch================\n");
@@ -173,19 +233,14 @@ bool
 SALAM::Instruction::commit()
 {
     if (dbg) DPRINTFS(Runtime, owner, "||  Current Cycle: %i\n", getCurrentCycle());
+    // A pipelined unit can take its next operation once the initiation interval has passed
+    if (getCurrentCycle() >= fuRelease) releaseFunctionalUnit();
     if (getCurrentCycle() == getCycleCount()) { // Instruction ready to be committed
         signalUsers();
         committed = true;
+        releaseFunctionalUnit();
         if (dbg) DPRINTFS(Runtime, owner, "||==Return: %s\n", committed ? "true" : "false");
         if (dbg) DPRINTFS(Runtime, owner, "||==commit================\n");
-        //std::cout << "\n\n\nTest 3 - FU[" << getFunctionalUnit() << "]\n\n\n";
-        if (hasFunctionalUnit()) {
-            //std::cout << "\n\n\nTest 2\n\n\n";
-            hw_interface->clearFunctionalUnit(getFunctionalUnit());
-           // hw_interface->functional_units->
-        } else {
-            // 
-        }
         return true;
     } else {
         if (dbg) DPRINTFS(Runtime, owner, "||  Remaining Cycles: %i\n", getCycleCount() - getCurrentCycle());
@@ -196,17 +251,114 @@ SALAM::Instruction::commit()
     return false;
 }
 
+// Lane-wise kernels. Lanes are packed in the vector registers and the loops
+// carry no cross-lane dependencies, so the host compiler maps them onto its
+// own SIMD units
+template <typename T>
+static void
+intLanes(uint64_t opcode, T *d, const T *x, const T *y, size_t lanes)
+{
+    typedef typename std::make_signed<T>::type S;
+    const T shiftMask = (sizeof(T) * 8) - 1;
+    switch (opcode) {
+        case llvm::Instruction::Add: for (size_t i = 0; i < lanes; i++) d[i] = x[i] + y[i]; break;
+        case llvm::Instruction::Sub: for (size_t i = 0; i < lanes; i++) d[i] = x[i] - y[i]; break;
+        case llvm::Instruction::Mul: for (size_t i = 0; i < lanes; i++) d[i] = x[i] * y[i]; break;
+        case llvm::Instruction::And: for (size_t i = 0; i < lanes; i++) d[i] = x[i] & y[i]; break;
+        case llvm::Instruction::Or: for (size_t i = 0; i < lanes; i++) d[i] = x[i] | y[i]; break;
+        case llvm::Instruction::Xor: for (size_t i = 0; i < lanes; i++) d[i] = x[i] ^ y[i]; break;
+        case llvm::Instruction::Shl: for (size_t i = 0; i < lanes; i++) d[i] = x[i] << (y[i] & shiftMask); break;
+        case llvm::Instruction::LShr: for (size_t i = 0; i < lanes; i++) d[i] = x[i] >> (y[i] & shiftMask); break;
+        case llvm::Instruction::AShr: for (size_t i = 0; i < lanes; i++) d[i] = (T)((S)x[i] >> (y[i] & shiftMask)); break;
+        // Division by zero is undefined in the IR. Lanes divided by zero read as zero
+        case llvm::Instruction::UDiv: for (size_t i = 0; i < lanes; i++) d[i] = y[i] ? (x[i] / y[i]) : 0; break;
+        case llvm::Instruction::URem: for (size_t i = 0; i < lanes; i++) d[i] = y[i] ? (x[i] % y[i]) : 0; break;
+        case llvm::Instruction::SDiv: for (size_t i = 0; i < lanes; i++) d[i] = y[i] ? (T)((S)x[i] / (S)y[i]) : 0; break;
+        case llvm::Instruction::SRem: for (size_t i = 0; i < lanes; i++) d[i] = y[i] ? (T)((S)x[i] % (S)y[i]) : 0; break;
+        default: assert(0 && "Unsupported vector integer operation");
+    }
+}
+
+template <typename T>
+static void
+fpLanes(uint64_t opcode, T *d, const T *x, const T *y, size_t lanes)
+{
+    switch (opcode) {
+        case llvm::Instruction::FAdd: for (size_t i = 0; i < lanes; i++) d[i] = x[i] + y[i]; break;
+        case llvm::Instruction::FSub: for (size_t i = 0; i < lanes; i++) d[i] = x[i] - y[i]; break;
+        case llvm::Instruction::FMul: for (size_t i = 0; i < lanes; i++) d[i] = x[i] * y[i]; break;
+        case llvm::Instruction::FDiv: for (size_t i = 0; i < lanes; i++) d[i] = x[i] / y[i]; break;
+        case llvm::Instruction::FRem: for (size_t i = 0; i < lanes; i++) d[i] = std::fmod(x[i], y[i]); break;
+        default: assert(0 && "Unsupported vector floating point operation");
+    }
+}
+
 void
-SALAM::Instruction::setOperandValue(uint64_t opuid)
+SALAM::Instruction::computeLanes()
 {
-    uint64_t count = 0;
-    for (auto it = operands.begin(); it != operands.end(); ++it) {
-        auto op = *it;
-        if (op.getUID() == opuid) {
-            if (dbg) DPRINTFS(Runtime, owner, "|| Storing Value in Op[%i]\n", count++);
-            op.updateOperandRegister();
-            //break;
-        } else count++;
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s across %d lanes\n", getIRString(), getLanes());
+    auto result = std::static_pointer_cast<SALAM::VectorRegister>(returnReg);
+    const uint8_t * x = operands.at(0).getLockedData();
+    const uint8_t * y = operands.at(1).getLockedData();
+    uint8_t * d = result->writableData();
+    size_t lanes = result->getLanes();
+    uint64_t opcode = getOpode();
+    switch (result->getLaneType()) {
+        case llvm::Type::FloatTyID:
+            fpLanes<float>(opcode, (float *)d, (const float *)x, (const float *)y, lanes);
+            break;
+        case llvm::Type::DoubleTyID:
+            fpLanes<double>(opcode, (double *)d, (const double *)x, (const double *)y, lanes);
+            break;
+        default:
+        {
+            switch (result->getLaneBytes()) {
+                case 1: intLanes<uint8_t>(opcode, d, x, y, lanes); break;
+                case 2: intLanes<uint16_t>(opcode, (uint16_t *)d, (const uint16_t *)x, (const uint16_t *)y, lanes); break;
+                case 4: intLanes<uint32_t>(opcode, (uint32_t *)d, (const uint32_t *)x, (const uint32_t *)y, lanes); break;
+                case 8: intLanes<uint64_t>(opcode, (uint64_t *)d, (const uint64_t *)x, (const uint64_t *)y, lanes); break;
+                default: assert(0 && "Unsupported vector lane width");
+            }
+        }
+    }
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
+}
+
+void
+SALAM::Instruction::computeKernel()
+{
+    uint64_t op1 = operands[0].getLockedBits();
+    uint64_t op2 = (operands.size() > 1) ? operands[1].getLockedBits() : 0;
+    setRegisterValue(staticInst->kernel(op1, op2));
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %#x, (%s) %#x\n",
+        operands[0].getIRStub(), op1,
+        (operands.size() > 1) ? operands[1].getIRStub() : "-", op2);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
+}
+
+void
+SALAM::Instruction::computeJIT()
+{
+    uint64_t ops[BlockJIT::maxOperands];
+    for (size_t i = 0; i < operands.size(); i++) ops[i] = operands[i].getLockedBits();
+    setRegisterValue(staticInst->jit(ops));
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s natively\n", getIRString());
+    if (dbg) {
+        for (size_t i = 0; i < operands.size(); i++)
+            DPRINTFS(RuntimeCompute, owner, "|| (%s) %#x\n", operands[i].getIRStub(), ops[i]);
+    }
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
+}
+
+void
+SALAM::Instruction::setOperandValue(uint64_t opuid, std::shared_ptr<SALAM::Register> source)
+{
+    for (size_t i = 0; i < operands.size(); i++) {
+        if (operands[i].getUID() == opuid) {
+            if (dbg) DPRINTFS(Runtime, owner, "|| Storing Value in Op[%i]\n", i);
+            operands[i].updateOperandRegister(source);
+        }
     }
     removeDynamicDependency(opuid);
 }
@@ -220,6 +372,19 @@ SALAM::Instruction::reset() {
     if (dbg) DPRINTFS(Runtime, owner, "||==reset=================\n");
 }
 
+void
+SALAM::Instruction::recycle() {
+    // Return a retired dynamic instance to its freshly cloned state. Operands
+    // are kept so runtimeInitialize() can reuse their registers
+    dynamicDependencies.clear();
+    dynamicUsers.clear();
+    readyQueue = nullptr;
+    sequence = 0;
+    running = false;
+    fuHeld = false;
+    reset();
+}
+
 void
 SALAM::Instruction::linkOperands(const SALAM::Operand &newOp)
 {
@@ -229,17 +394,23 @@ SALAM::Instruction::linkOperands(const SALAM::Operand &newOp)
 
 //std::deque<uint64_t>
 std::vector<uint64_t>
-SALAM::Instruction::runtimeInitialize() {
+SALAM::Instruction::runtimeInitialize(const uint64_t * registers) {
     assert(getDependencyCount() == 0);
     //std::deque<uint64_t> dep_uids;
     std::vector<uint64_t> dep_uids;
+    // Recycled instances already hold an operand for each static dependency
+    bool reuseOperands = (operands.size() == staticInst->dependencies.size());
+    dynamicDependencies.reserve(staticInst->dependencies.size());
 
-    for (auto it = staticDependencies.begin(); it != staticDependencies.end(); ++it) {
-        std::shared_ptr<SALAM::Value> static_dependency = *it;
+    for (auto i = 0; i < staticInst->dependencies.size(); i++) {
+        std::shared_ptr<SALAM::Value> static_dependency = staticInst->dependencies.at(i);
         auto dep_uid = static_dependency->getUID();
-        operands.push_back(SALAM::Operand(static_dependency));
-        if ((static_dependency->isConstant()) || (static_dependency->isArgument())) {
-            operands.back().updateOperandRegister();
+        if (!reuseOperands) operands.push_back(SALAM::Operand(static_dependency));
+        uint64_t slot = getOperandSlot(i);
+        if (registers && (slot != StaticInstruction::noSlot)) {
+            operands[i].lockValue(registers[slot]);
+        } else if ((static_dependency->isConstant()) || (static_dependency->isArgument())) {
+            operands[i].updateOperandRegister();
         } else {
             dep_uids.push_back(dep_uid);
         }
@@ -266,11 +437,6 @@ BadInstruction::BadInstruction(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
                                Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -301,11 +467,6 @@ Ret::Ret(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -343,17 +504,12 @@ Br::Br(uint64_t id, gem5::SimObject * owner, bool dbg,
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
 
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 std::shared_ptr<SALAM::BasicBlock>
 Br::getTarget() {
 
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching Branch: %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching Branch: %s\n", getIRString());
     if(conditional) {
     #if USE_LLVM_AP_VALUES
         if (condition->getIntRegValue().isOneValue()) {
@@ -407,7 +563,7 @@ Br::initialize(llvm::Value * irval,
             assert(0);
         } else {
             condition = mapit->second;
-            staticDependencies.push_back(condition);
+            staticInst->dependencies.push_back(condition);
             trueDestination = defaultDestination;
 
             llvm::Value * falseDestValue = br->getSuccessor(1);
@@ -450,16 +606,11 @@ Switch::Switch(uint64_t id, gem5::SimObject * owner, bool dbg,
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
 
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 std::shared_ptr<SALAM::BasicBlock>
 Switch::getTarget() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching Switch: %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching Switch: %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     auto opdata = (operands.front().getIntRegValue());
 
@@ -524,7 +675,7 @@ Switch::initialize(llvm::Value * irval,
         this->cases.push_back(newArgs);
     }
 
-    staticDependencies.push_back(tmpStaticDeps.front());
+    staticInst->dependencies.push_back(tmpStaticDeps.front());
     defaultDestination = std::dynamic_pointer_cast<SALAM::BasicBlock>(tmpStaticDeps.at(1));
 }
 
@@ -571,11 +722,6 @@ Add::Add(uint64_t id, gem5::SimObject * owner, bool dbg,
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
 
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -588,7 +734,7 @@ Add::initialize(llvm::Value *irval,
 
 void
 Add::compute() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -602,7 +748,7 @@ Add::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s + (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -610,7 +756,7 @@ Add::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d + (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -636,11 +782,6 @@ FAdd::FAdd(uint64_t id, gem5::SimObject * owner, bool dbg,
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
 
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -654,7 +795,7 @@ void
 FAdd::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APFloat op1 = (operands.at(0).getFloatRegValue());
     llvm::APFloat op2 = (operands.at(1).getFloatRegValue());
@@ -668,7 +809,7 @@ FAdd::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s + (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     uint64_t bitcastResult;
@@ -681,7 +822,7 @@ FAdd::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f + (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -693,7 +834,7 @@ FAdd::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f + (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -726,11 +867,6 @@ Sub::Sub(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -745,7 +881,7 @@ void
 Sub::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -759,7 +895,7 @@ Sub::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s - (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -767,7 +903,7 @@ Sub::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d - (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -792,11 +928,6 @@ FSub::FSub(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -811,7 +942,7 @@ void
 FSub::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APFloat op1 = (operands.at(0).getFloatRegValue());
     llvm::APFloat op2 = (operands.at(1).getFloatRegValue());
@@ -825,7 +956,7 @@ FSub::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s - (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     uint64_t bitcastResult;
@@ -838,7 +969,7 @@ FSub::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f - (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -850,7 +981,7 @@ FSub::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f - (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -884,11 +1015,6 @@ Mul::Mul(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -901,7 +1027,7 @@ Mul::initialize(llvm::Value * irval,
 
 void
 Mul::compute() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -915,7 +1041,7 @@ Mul::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s * (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -923,7 +1049,7 @@ Mul::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d * (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -948,11 +1074,6 @@ FMul::FMul(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -967,7 +1088,7 @@ void
 FMul::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APFloat op1 = (operands.at(0).getFloatRegValue());
     llvm::APFloat op2 = (operands.at(1).getFloatRegValue());
@@ -981,7 +1102,7 @@ FMul::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s * (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     uint64_t bitcastResult;
@@ -994,7 +1115,7 @@ FMul::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f * (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -1006,7 +1127,7 @@ FMul::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f * (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -1040,11 +1161,6 @@ UDiv::UDiv(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1059,7 +1175,7 @@ void
 UDiv::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1073,7 +1189,7 @@ UDiv::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s / (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -1081,7 +1197,7 @@ UDiv::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d / (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -1106,11 +1222,6 @@ SDiv::SDiv(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1125,7 +1236,7 @@ void
 SDiv::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1139,7 +1250,7 @@ SDiv::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s / (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     int64_t op1 = operands.at(0).getSIntRegValue();
@@ -1148,7 +1259,7 @@ SDiv::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d / (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
     setRegisterValue((uint64_t)result);
 #endif
 }
@@ -1173,11 +1284,6 @@ FDiv::FDiv(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1192,7 +1298,7 @@ void
 FDiv::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APFloat op1 = (operands.at(0).getFloatRegValue());
     llvm::APFloat op2 = (operands.at(1).getFloatRegValue());
@@ -1206,7 +1312,7 @@ FDiv::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s / (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     uint64_t bitcastResult;
@@ -1219,7 +1325,7 @@ FDiv::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f / (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -1231,7 +1337,7 @@ FDiv::compute() {
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f / (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -1265,11 +1371,6 @@ URem::URem(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1284,7 +1385,7 @@ void
 URem::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1298,7 +1399,7 @@ URem::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s % (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -1306,7 +1407,7 @@ URem::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d % (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -1331,11 +1432,6 @@ SRem::SRem(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1350,7 +1446,7 @@ void
 SRem::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1364,7 +1460,7 @@ SRem::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s % (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     int64_t op1 = operands.at(0).getSIntRegValue();
@@ -1373,7 +1469,7 @@ SRem::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d % (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
     setRegisterValue((uint64_t)result);
 #endif
 }
@@ -1398,11 +1494,6 @@ FRem::FRem(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1417,12 +1508,12 @@ void
 FRem::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APFloat op1 = (operands.at(0).getFloatRegValue());
     llvm::APFloat op2 = (operands.at(1).getFloatRegValue());
     llvm::APFloat result = op1;
-    auto err = result.remainder(op2);
+    auto err = result.mod(op2);
     assert(err == llvm::APFloatBase::opStatus::opOK);
     llvm::SmallString<8> op1str;
     llvm::SmallString<8> op2str;
@@ -1433,7 +1524,7 @@ FRem::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s % (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     uint64_t bitcastResult;
@@ -1442,11 +1533,11 @@ FRem::compute() {
         {
             float op1 = operands.at(0).getFloatFromReg();
             float op2 = operands.at(1).getFloatFromReg();
-            float result = std::remainderf(op1, op2);
+            float result = std::fmod(op1, op2);
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f % (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -1454,11 +1545,11 @@ FRem::compute() {
         {
             double op1 = operands.at(0).getDoubleFromReg();
             double op2 = operands.at(1).getDoubleFromReg();
-            double result = std::remainder(op1, op2);
+            double result = std::fmod(op1, op2);
             if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %f % (%s) %f\n",
                 operands.at(0).getIRStub(), op1,
                 operands.at(1).getIRStub(), op2);
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", ir_stub, result);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
             bitcastResult = *(uint64_t *)&result;
             break;
         }
@@ -1492,11 +1583,6 @@ Shl::Shl(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1511,7 +1597,7 @@ void
 Shl::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1525,7 +1611,7 @@ Shl::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s << (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -1533,7 +1619,7 @@ Shl::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d << (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -1558,11 +1644,6 @@ LShr::LShr(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1577,7 +1658,7 @@ void
 LShr::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1591,7 +1672,7 @@ LShr::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s >> (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -1599,7 +1680,7 @@ LShr::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d >> (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -1624,11 +1705,6 @@ AShr::AShr(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1643,7 +1719,7 @@ void
 AShr::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1657,7 +1733,7 @@ AShr::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s >> (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     int64_t op1 = operands.at(0).getSIntRegValue();
@@ -1666,7 +1742,7 @@ AShr::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d >> (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
     setRegisterValue((uint64_t)result);
 #endif
 }
@@ -1691,11 +1767,6 @@ And::And(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1710,7 +1781,7 @@ void
 And::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1724,7 +1795,7 @@ And::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s & (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -1732,7 +1803,7 @@ And::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d & (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -1757,11 +1828,6 @@ Or::Or(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1776,7 +1842,7 @@ void
 Or::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1790,7 +1856,7 @@ Or::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s | (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -1798,7 +1864,7 @@ Or::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d | (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -1823,11 +1889,6 @@ Xor::Xor(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1842,7 +1903,7 @@ void
 Xor::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt op1 = (operands.at(0).getIntRegValue());
     llvm::APInt op2 = (operands.at(1).getIntRegValue());
@@ -1856,7 +1917,7 @@ Xor::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %s ^ (%s) %s \n",
         operands.at(0).getIRStub(), op1str.c_str(),
         operands.at(1).getIRStub(), op2str.c_str());
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     uint64_t op1 = operands.at(0).getUIntRegValue();
     uint64_t op2 = operands.at(1).getUIntRegValue();
@@ -1864,7 +1925,7 @@ Xor::compute() {
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| (%s) %d ^ (%s) %d\n",
         operands.at(0).getIRStub(), op1,
         operands.at(1).getIRStub(), op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -1889,11 +1950,6 @@ Load::Load(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1904,23 +1960,23 @@ Load::initialize(llvm::Value * irval,
     // ****** //
     llvm::LoadInst * inst = llvm::dyn_cast<llvm::LoadInst>(irval);
     this->align = inst->getAlignment();
-    if (staticDependencies.front()->isGlobalConstant()) loadingInternal = true;
+    if (staticInst->dependencies.front()->isGlobalConstant()) loadingInternal = true;
 }
 
 void
 Load::compute() {
     // Load does not use compute normally. Special handling is used in the scheduler.
     // We instead use compute just for debug printout
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, registerDataString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
 }
 
 void
 Load::loadInternal() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", getIRString());
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Loading internal value from %s\n",
         operands.front().getIRString());
-    setRegisterValue(operands.front().getOpRegister());
+    setRegisterValue(operands.front().getLockedData());
     commit();
 }
 
@@ -1928,7 +1984,7 @@ MemoryRequest *
 Load::createMemoryRequest() {
     Addr memAddr = (operands.front().getPtrRegValue());
     size_t reqLen = getSizeInBytes();
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", getIRString());
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Addr[%x] Size[%i]\n", memAddr, reqLen);
     return new MemoryRequest(memAddr, reqLen);
 }
@@ -1952,11 +2008,6 @@ Store::Store(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -1981,32 +2032,17 @@ Store::createMemoryRequest() {
 
     MemoryRequest * req;
 
-    auto dataRegister = operands.at(0).getOpRegister();
-    // Copy data from the register
-    if (dataRegister->isPtr()) {
-        uint64_t regData = dataRegister->getPtrData();
-        req = new MemoryRequest(memAddr, (uint8_t *)&regData, reqLen);
+    auto &data = operands.at(0);
+    // Copy data from the locked operand
+    if (data.getLockedVector()) {
+        // Vector stores issue as a single wide request
+        req = new MemoryRequest(memAddr, data.getLockedData(), reqLen);
     } else {
-    #if USE_LLVM_AP_VALUES
-        llvm::APInt regAPData;
-        if (dataRegister->isInt()) {
-            regAPData = (dataRegister->getIntData());
-        } else {
-            regAPData = dataRegister->getFloatData().bitcastToAPInt();
-        }
-        req = new MemoryRequest(memAddr, regAPData.getRawData(), reqLen);
-    #else
-        uint64_t regData;
-        if (dataRegister->isInt()) {
-            regData = dataRegister->getIntData();
-        } else {
-            regData = dataRegister->getFloatData();
-        }
+        uint64_t regData = data.getLockedBits();
         req = new MemoryRequest(memAddr, (uint8_t *)&regData, reqLen);
-    #endif
-        if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", ir_string);
-        if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Addr[%x] Size[%i]\n", memAddr, reqLen);
     }
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", getIRString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Addr[%x] Size[%i]\n", memAddr, reqLen);
 
     return req;
 }
@@ -2030,11 +2066,6 @@ GetElementPtr::GetElementPtr(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2089,7 +2120,7 @@ GetElementPtr::initialize(llvm::Value * irval,
 
 void
 GetElementPtr::compute() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
     uint64_t ptr = (operands.front().getPtrRegValue());
     int64_t offset = 0;
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Index Values\n");
@@ -2135,11 +2166,6 @@ Trunc::Trunc(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2154,16 +2180,16 @@ void
 Trunc::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt result = operands.at(0).getIntRegValue().trunc(size);
     llvm::SmallString<8> resstr;
     result.toStringUnsigned(resstr);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     // The trunc is handled automatically when we set the return register
     uint64_t result = operands.at(0).getUIntRegValue();
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -2188,11 +2214,6 @@ ZExt::ZExt(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2207,16 +2228,16 @@ void
 ZExt::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt result = operands.at(0).getIntRegValue().zext(size);
     llvm::SmallString<8> resstr;
     result.toStringUnsigned(resstr);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
 #else
     // Unsigned data doesn't need any modification when ZExtending
     uint64_t result = operands.at(0).getUIntRegValue();
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
 #endif
     setRegisterValue(result);
 }
@@ -2241,11 +2262,6 @@ SExt::SExt(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2260,16 +2276,16 @@ void
 SExt::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 #if USE_LLVM_AP_VALUES
     llvm::APInt result = operands.at(0).getIntRegValue().sext(size);
     llvm::SmallString<8> resstr;
     result.toStringSigned(resstr);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, resstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), resstr.c_str());
     setRegisterValue(result);
 #else
     int64_t result = operands.at(0).getSIntRegValue();
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, result);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), result);
     setRegisterValue((uint64_t)result);
 #endif
 }
@@ -2294,11 +2310,6 @@ FPToUI::FPToUI(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2327,7 +2338,7 @@ FPToUI::compute() {
     setRegisterValue(tmp);
     llvm::SmallString<8> tmpstr;
     tmp.toString(tmpstr);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, tmpstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), tmpstr.c_str());
 #else
     switch (operands.front().getSize()) {
         case 32:
@@ -2373,11 +2384,6 @@ FPToSI::FPToSI(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2406,14 +2412,14 @@ FPToSI::compute() {
     setRegisterValue(tmp);
     llvm::SmallString<8> tmpstr;
     tmp.toString(tmpstr);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, tmpstr.c_str());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), tmpstr.c_str());
 #else
     switch (operands.front().getSize()) {
         case 32:
         {
             float opdata = operands.front().getFloatFromReg();
             int64_t tmp = (int64_t)opdata; // Truncate to integer
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, tmp);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), tmp);
             setRegisterValue((uint64_t)tmp);
             break;
         }
@@ -2421,7 +2427,7 @@ FPToSI::compute() {
         {
             double opdata = operands.front().getDoubleFromReg();
             int64_t tmp = (int64_t)opdata; // Truncate to integer
-            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", ir_stub, tmp);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %d\n", getIRStub(), tmp);
             setRegisterValue((uint64_t)tmp);
             break;
         }
@@ -2454,11 +2460,6 @@ UIToFP::UIToFP(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2526,11 +2527,6 @@ SIToFP::SIToFP(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2598,11 +2594,6 @@ FPTrunc::FPTrunc(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2664,11 +2655,6 @@ FPExt::FPExt(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2730,11 +2716,6 @@ PtrToInt::PtrToInt(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2775,11 +2756,6 @@ IntToPtr::IntToPtr(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2823,11 +2799,6 @@ BitCast::BitCast(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2868,11 +2839,6 @@ ICmp::ICmp(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -2889,7 +2855,7 @@ ICmp::initialize(llvm::Value * irval,
 
 void
 ICmp::compute() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
     bool result = false;
 #if USE_LLVM_AP_VALUES
     if (operands.at(0).hasIntVal() && operands.at(1).hasIntVal()){
@@ -2956,7 +2922,7 @@ ICmp::compute() {
     }
 #endif
     setRegisterValue(result);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, result ? "TRUE" : "FALSE");
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), result ? "TRUE" : "FALSE");
 }
 
 // SALAM-FCmp // ------------------------------------------------------------//
@@ -2979,11 +2945,6 @@ FCmp::FCmp(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -3002,7 +2963,7 @@ void
 FCmp::compute() {
     // Perform computations
     // Store results in temp location
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
     bool result = false;
 #if USE_LLVM_AP_VALUES
     auto op1 = operands.at(0).getFloatRegValue();
@@ -3176,7 +3137,7 @@ FCmp::compute() {
 #endif
     setRegisterValue(result);
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Comparing %f, %f\n", op1,op2);
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, result ? "TRUE" : "FALSE");
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), result ? "TRUE" : "FALSE");
 }
 
 // SALAM-Phi // -------------------------------------------------------------//
@@ -3196,13 +3157,9 @@ Phi::Phi(uint64_t id, gem5::SimObject * owner, bool dbg,
          uint64_t OpCode,
               uint64_t cycles,
               uint64_t fu) :
-         Instruction(id, owner, dbg, OpCode, cycles,fu)
+         Instruction(id, owner, dbg, OpCode, cycles,fu),
+         phiArgs(std::make_shared<phiArgsTy>())
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -3216,25 +3173,41 @@ Phi::initialize(llvm::Value * irval,
     for (int i = 0; i < Instruction::getStaticDependencies().size();) {
         args.second = Instruction::getStaticDependencies(i); ++i;
         args.first = std::dynamic_pointer_cast<SALAM::BasicBlock>(Instruction::getStaticDependencies(i)); ++i;
-        this->phiArgs.insert(args);
+        this->phiArgs->insert(args);
     }
 }
 
 //std::deque<uint64_t>
 std::vector<uint64_t>
-Phi::runtimeInitialize() {
+Phi::runtimeInitialize(const uint64_t * registers) {
     assert(getDependencyCount() == 0);
     //std::deque<uint64_t> dep_uids;
     std::vector<uint64_t> dep_uids;
     std::shared_ptr<SALAM::Value> static_dependency;
 
-    auto it = phiArgs.find(previousBB);
-    if (it != phiArgs.end()) static_dependency = it->second;
+    auto it = phiArgs->find(previousBB);
+    if (it != phiArgs->end()) static_dependency = it->second;
     else assert(0 && "Previous BasicBlock not found in PHI args");
 
     auto dep_uid = static_dependency->getUID();
-    operands.push_back(SALAM::Operand(static_dependency));
-    if ((static_dependency->isConstant()) || (static_dependency->isArgument())) {
+    // Recycled instances keep their operand when entered from the same block
+    if (operands.empty() || (operands.front().getUID() != dep_uid)) {
+        operands.clear();
+        operands.push_back(SALAM::Operand(static_dependency));
+    }
+    // Dependencies alternate between incoming values and their blocks
+    uint64_t slot = StaticInstruction::noSlot;
+    if (registers) {
+        for (size_t i = 1; i < staticInst->dependencies.size(); i += 2) {
+            if (staticInst->dependencies[i] == previousBB) {
+                slot = getOperandSlot(i - 1);
+                break;
+            }
+        }
+    }
+    if (slot != StaticInstruction::noSlot) {
+        operands.back().lockValue(registers[slot]);
+    } else if ((static_dependency->isConstant()) || (static_dependency->isArgument())) {
         operands.back().updateOperandRegister();
     } else {
         dep_uids.push_back(dep_uid);
@@ -3245,18 +3218,18 @@ Phi::runtimeInitialize() {
 
 void
 Phi::compute() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| PHI entered from %s, using value: %s\n",
         previousBB->getIRStub(), operands.front().getIRString());
 
-    setRegisterValue(operands.front().getOpRegister());
+    setRegisterValue(operands.front().getLockedData());
 }
 
 void
 Phi::setPrevBB(std::shared_ptr<SALAM::BasicBlock> prevBB)
 {
-    auto it = phiArgs.find(prevBB);
-    if (it != phiArgs.end()) previousBB = prevBB;
+    auto it = phiArgs->find(prevBB);
+    if (it != phiArgs->end()) previousBB = prevBB;
     else assert(0 && "Previous BasicBlock not found in PHI args");
 }
 
@@ -3264,8 +3237,8 @@ valueListTy
 Phi::getStaticDependencies() const {
     valueListTy deps;
 
-    auto it = phiArgs.find(previousBB);
-    if (it != phiArgs.end()) deps.push_back(it->second);
+    auto it = phiArgs->find(previousBB);
+    if (it != phiArgs->end()) deps.push_back(it->second);
     else assert(0 && "Previous BasicBlock not found in PHI args");
 
     return deps;
@@ -3273,6 +3246,51 @@ Phi::getStaticDependencies() const {
 
 
 // SALAM-Call // ------------------------------------------------------------//
+IntrinsicKind
+lookupIntrinsic(const llvm::Function * callee)
+{
+    // Intrinsics the runtime can execute. Calls to any other declaration
+    // cannot be simulated
+    static const std::map<llvm::Intrinsic::ID, IntrinsicKind> intrinsics = {
+        {llvm::Intrinsic::memcpy, IntrinsicKind::MemCopy},
+        {llvm::Intrinsic::memmove, IntrinsicKind::MemCopy},
+        {llvm::Intrinsic::memset, IntrinsicKind::MemSet},
+        {llvm::Intrinsic::fmuladd, IntrinsicKind::FMulAdd},
+        {llvm::Intrinsic::fma, IntrinsicKind::FMulAdd},
+        {llvm::Intrinsic::sqrt, IntrinsicKind::Sqrt},
+        {llvm::Intrinsic::fabs, IntrinsicKind::FAbs},
+        {llvm::Intrinsic::minnum, IntrinsicKind::MinNum},
+        {llvm::Intrinsic::maxnum, IntrinsicKind::MaxNum},
+        {llvm::Intrinsic::lifetime_start, IntrinsicKind::NoOp},
+        {llvm::Intrinsic::lifetime_end, IntrinsicKind::NoOp},
+        {llvm::Intrinsic::assume, IntrinsicKind::NoOp},
+        {llvm::Intrinsic::donothing, IntrinsicKind::NoOp},
+        {llvm::Intrinsic::sideeffect, IntrinsicKind::NoOp},
+        {llvm::Intrinsic::experimental_noalias_scope_decl, IntrinsicKind::NoOp},
+    };
+    if (!callee->isDeclaration()) return IntrinsicKind::None;
+    // Debug info intrinsics, present in any IR built with -g, only describe
+    // source variables
+    if (callee->getName().startswith("llvm.dbg.")) return IntrinsicKind::NoOp;
+    auto it = intrinsics.find(callee->getIntrinsicID());
+    if (it == intrinsics.end()) return IntrinsicKind::Unsupported;
+    return it->second;
+}
+
+template <typename T>
+static T
+mathIntrinsic(IntrinsicKind kind, T a, T b, T c)
+{
+    switch (kind) {
+        case IntrinsicKind::FMulAdd: return std::fma(a, b, c);
+        case IntrinsicKind::Sqrt: return std::sqrt(a);
+        case IntrinsicKind::FAbs: return std::fabs(a);
+        case IntrinsicKind::MinNum: return std::fmin(a, b);
+        case IntrinsicKind::MaxNum: return std::fmax(a, b);
+        default: assert(0 && "Not a math intrinsic"); return 0;
+    }
+}
+
 void // Debugging Interface
 Call::dumper() {
 
@@ -3292,11 +3310,6 @@ Call::Call(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -3304,14 +3317,85 @@ Call::initialize(llvm::Value * irval,
                 irvmap * irmap,
                 SALAM::valueListTy * valueList) {
     SALAM::Instruction::initialize(irval, irmap, valueList);
-    callee = staticDependencies.back();
-    staticDependencies.pop_back();
+    callee = staticInst->dependencies.back();
+    staticInst->dependencies.pop_back();
     // ****** //
+    llvm::CallInst * inst = llvm::dyn_cast<llvm::CallInst>(irval);
+    if (llvm::Function * calledFunc = inst->getCalledFunction())
+        intrinsic = lookupIntrinsic(calledFunc);
+    // Markers read none of their operands, some of which are metadata with
+    // no register, so they wait on no producers
+    if (intrinsic == IntrinsicKind::NoOp) staticInst->dependencies.clear();
 }
 
 void
 Call::compute() {
-    // Call does not use compute. Special handling is used in the scheduler.
+    // Calls to functions and bulk memory intrinsics do not use compute.
+    // Special handling is used in the scheduler.
+    if ((intrinsic == IntrinsicKind::None) || (intrinsic == IntrinsicKind::NoOp) ||
+        isMemoryIntrinsic()) return;
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+#if USE_LLVM_AP_VALUES
+    assert(0 && "Math intrinsics are only modeled with native values.");
+#else
+    size_t args = operands.size();
+    uint64_t bitcastResult;
+    switch(size) {
+        case 32:
+        {
+            float a = operands.at(0).getFloatFromReg();
+            float b = (args > 1) ? operands.at(1).getFloatFromReg() : 0;
+            float c = (args > 2) ? operands.at(2).getFloatFromReg() : 0;
+            float result = mathIntrinsic(intrinsic, a, b, c);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
+            bitcastResult = *(uint64_t *)&result;
+            break;
+        }
+        case 64:
+        {
+            double a = operands.at(0).getDoubleFromReg();
+            double b = (args > 1) ? operands.at(1).getDoubleFromReg() : 0;
+            double c = (args > 2) ? operands.at(2).getDoubleFromReg() : 0;
+            double result = mathIntrinsic(intrinsic, a, b, c);
+            if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %f\n", getIRStub(), result);
+            bitcastResult = *(uint64_t *)&result;
+            break;
+        }
+        default:
+        {
+            assert(0 && "Unsupported floating point type." &&
+                   "Compile with AP values enabled for extended FP support.");
+        }
+    }
+    setRegisterValue(bitcastResult);
+#endif
+}
+
+MemoryRequest *
+Call::createMemoryRequest() {
+    Addr memAddr = getBurstDestination();
+    size_t reqLen = getBurstLength();
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", getIRString());
+    if (intrinsic == IntrinsicKind::MemSet) {
+    #if USE_LLVM_AP_VALUES
+        uint8_t fillValue = operands.at(1).getIntRegValue().getZExtValue();
+    #else
+        uint8_t fillValue = operands.at(1).getUIntRegValue();
+    #endif
+        if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Set Addr[%x] Size[%i] to %d\n", memAddr, reqLen, fillValue);
+        std::vector<uint8_t> fill(reqLen, fillValue);
+        return new MemoryRequest(memAddr, fill.data(), reqLen);
+    }
+    // Copies read the whole source before writing, which also makes
+    // overlapping memmoves safe
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Copy Addr[%x] to Addr[%x] Size[%i]\n",
+        getBurstSource(), memAddr, reqLen);
+    return new MemoryRequest(getBurstSource(), reqLen);
+}
+
+MemoryRequest *
+Call::createWriteBurst(const uint8_t * data) {
+    return new MemoryRequest(getBurstDestination(), data, getBurstLength());
 }
 
 // SALAM-Select // ----------------------------------------------------------//
@@ -3334,11 +3418,6 @@ Select::Select(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu) :
          Instruction(id, owner, dbg, OpCode, cycles,fu)
 {
-    std::vector<uint64_t> base_params;
-    base_params.push_back(id);
-    base_params.push_back(OpCode);
-    base_params.push_back(cycles);
-    conditions.push_back(base_params);
 }
 
 void
@@ -3365,20 +3444,394 @@ Select::initialize(llvm::Value * irval,
 
 void
 Select::compute() {
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", ir_string);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
 
-    auto cond = operands.at(0);
-    auto trueVal = operands.at(1);
-    auto falseVal = operands.at(2);
+    auto &cond = operands.at(0);
+    auto &trueVal = operands.at(1);
+    auto &falseVal = operands.at(2);
 
 #if USE_LLVM_AP_VALUES
-    auto resultReg = (cond.getIntRegValue().isOneValue()) ? trueVal.getOpRegister() : falseVal.getOpRegister();
+    auto result = (cond.getIntRegValue().isOneValue()) ? trueVal.getLockedData() : falseVal.getLockedData();
 #else
-    auto resultReg = (cond.getUIntRegValue() == 1) ? trueVal.getOpRegister() : falseVal.getOpRegister();
+    auto result = (cond.getUIntRegValue() == 1) ? trueVal.getLockedData() : falseVal.getLockedData();
     if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Selecting %s condition\n", (cond.getUIntRegValue() == 1) ? "TRUE" : "FALSE");
-    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", ir_stub, (cond.getUIntRegValue() == 1) ? trueVal.getIRStub() : falseVal.getIRStub());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), (cond.getUIntRegValue() == 1) ? trueVal.getIRStub() : falseVal.getIRStub());
 #endif
-    setRegisterValue(resultReg);
+    setRegisterValue(result);
+}
+
+// SALAM-ExtractElement // --------------------------------------------------//
+void // Debugging Interface
+ExtractElement::dumper() {
+
+}
+
+std::shared_ptr<SALAM::Instruction>
+createExtractElementInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) {
+    return std::make_shared<SALAM::ExtractElement>(id, owner, dbg, OpCode, cycles, fu);
+}
+
+ExtractElement::ExtractElement(uint64_t id, gem5::SimObject * owner, bool dbg,
+         uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) :
+         Instruction(id, owner, dbg, OpCode, cycles,fu)
+{
+}
+
+void
+ExtractElement::initialize(llvm::Value * irval,
+                irvmap * irmap,
+                SALAM::valueListTy * valueList) {
+    SALAM::Instruction::initialize(irval, irmap, valueList);
+    // ****** //
+}
+
+void
+ExtractElement::compute() {
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    auto vec = operands.at(0).getLockedVector();
+    uint64_t lane = operands.at(1).getUIntRegValue();
+    // Out of range indices are poison in the IR. Read them as zero
+    uint64_t bits = (lane < vec->getLanes()) ? vec->getLane(lane) : 0;
+    setRegisterValue(bits);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s[%d] = %s\n", getIRStub(),
+        operands.at(0).getIRStub(), lane, registerDataString());
+}
+
+// SALAM-InsertElement // ---------------------------------------------------//
+void // Debugging Interface
+InsertElement::dumper() {
+
+}
+
+std::shared_ptr<SALAM::Instruction>
+createInsertElementInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) {
+    return std::make_shared<SALAM::InsertElement>(id, owner, dbg, OpCode, cycles, fu);
+}
+
+InsertElement::InsertElement(uint64_t id, gem5::SimObject * owner, bool dbg,
+         uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) :
+         Instruction(id, owner, dbg, OpCode, cycles,fu)
+{
+}
+
+void
+InsertElement::initialize(llvm::Value * irval,
+                irvmap * irmap,
+                SALAM::valueListTy * valueList) {
+    SALAM::Instruction::initialize(irval, irmap, valueList);
+    // ****** //
+}
+
+void
+InsertElement::compute() {
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    auto result = std::static_pointer_cast<SALAM::VectorRegister>(returnReg);
+    setRegisterValue(operands.at(0).getLockedData());
+    uint64_t lane = operands.at(2).getUIntRegValue();
+    if (lane < result->getLanes())
+        result->setLane(lane, operands.at(1).getLockedBits());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
+}
+
+// SALAM-ShuffleVector // ---------------------------------------------------//
+void // Debugging Interface
+ShuffleVector::dumper() {
+
+}
+
+std::shared_ptr<SALAM::Instruction>
+createShuffleVectorInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) {
+    return std::make_shared<SALAM::ShuffleVector>(id, owner, dbg, OpCode, cycles, fu);
+}
+
+ShuffleVector::ShuffleVector(uint64_t id, gem5::SimObject * owner, bool dbg,
+         uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) :
+         Instruction(id, owner, dbg, OpCode, cycles,fu)
+{
+}
+
+void
+ShuffleVector::initialize(llvm::Value * irval,
+                irvmap * irmap,
+                SALAM::valueListTy * valueList) {
+    SALAM::Instruction::initialize(irval, irmap, valueList);
+    // ****** //
+    llvm::ShuffleVectorInst * inst = llvm::dyn_cast<llvm::ShuffleVectorInst>(irval);
+    assert(inst);
+    llvm::SmallVector<int, 16> shuffleMask;
+    inst->getShuffleMask(shuffleMask);
+    mask = std::make_shared<const std::vector<int>>(shuffleMask.begin(), shuffleMask.end());
+}
+
+void
+ShuffleVector::compute() {
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    auto result = std::static_pointer_cast<SALAM::VectorRegister>(returnReg);
+    auto first = operands.at(0).getLockedVector();
+    auto second = operands.at(1).getLockedVector();
+    int sourceLanes = first->getLanes();
+    // The gathered lanes count as one write of the result
+    result->writableData();
+    for (size_t lane = 0; lane < mask->size(); lane++) {
+        int src = mask->at(lane);
+        uint64_t bits = 0;
+        if ((src >= 0) && (src < sourceLanes)) bits = first->getLane(src);
+        else if (src >= sourceLanes) bits = second->getLane(src - sourceLanes);
+        result->setLane(lane, bits);
+    }
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
+}
+
+// SALAM-AtomicRMW // -------------------------------------------------------//
+void // Debugging Interface
+AtomicRMW::dumper() {
+
+}
+
+std::shared_ptr<SALAM::Instruction>
+createAtomicRMWInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) {
+    return std::make_shared<SALAM::AtomicRMW>(id, owner, dbg, OpCode, cycles, fu);
+}
+
+AtomicRMW::AtomicRMW(uint64_t id, gem5::SimObject * owner, bool dbg,
+         uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) :
+         Instruction(id, owner, dbg, OpCode, cycles,fu)
+{
+}
+
+void
+AtomicRMW::initialize(llvm::Value * irval,
+                irvmap * irmap,
+                SALAM::valueListTy * valueList) {
+    SALAM::Instruction::initialize(irval, irmap, valueList);
+    // ****** //
+    llvm::AtomicRMWInst * inst = llvm::dyn_cast<llvm::AtomicRMWInst>(irval);
+    assert(inst);
+    operation = inst->getOperation();
+}
+
+void
+AtomicRMW::compute() {
+    // The update is applied at the memory side. The register already holds
+    // the value read back with the response
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
+}
+
+// Builds the memory side update of an atomicrmw on a T wide location
+template <typename T>
+static AtomicOpFunctor *
+integerAtomicOp(llvm::AtomicRMWInst::BinOp op, uint64_t bits)
+{
+    typedef typename std::make_signed<T>::type S;
+    T operand = static_cast<T>(bits);
+    switch (op) {
+        case llvm::AtomicRMWInst::Xchg: return new AtomicOpExch<T>(operand);
+        case llvm::AtomicRMWInst::Add: return new AtomicOpAdd<T>(operand);
+        case llvm::AtomicRMWInst::Sub: return new AtomicOpSub<T>(operand);
+        case llvm::AtomicRMWInst::And: return new AtomicOpAnd<T>(operand);
+        case llvm::AtomicRMWInst::Or: return new AtomicOpOr<T>(operand);
+        case llvm::AtomicRMWInst::Xor: return new AtomicOpXor<T>(operand);
+        case llvm::AtomicRMWInst::UMax: return new AtomicOpMax<T>(operand);
+        case llvm::AtomicRMWInst::UMin: return new AtomicOpMin<T>(operand);
+        case llvm::AtomicRMWInst::Nand:
+            return new AtomicGeneric2Op<T>(operand, [](T *b, T a) { *b = ~(*b & a); });
+        case llvm::AtomicRMWInst::Max:
+            return new AtomicGeneric2Op<T>(operand, [](T *b, T a) { if ((S)a > (S)*b) *b = a; });
+        case llvm::AtomicRMWInst::Min:
+            return new AtomicGeneric2Op<T>(operand, [](T *b, T a) { if ((S)a < (S)*b) *b = a; });
+        default: return nullptr;
+    }
+}
+
+// Floating point updates operate on the raw bits held in memory
+template <typename T, typename F>
+static AtomicOpFunctor *
+floatAtomicOp(llvm::AtomicRMWInst::BinOp op, uint64_t bits)
+{
+    static_assert(sizeof(T) == sizeof(F), "Mismatched float atomic width");
+    T operand = static_cast<T>(bits);
+    switch (op) {
+    #if LLVM_VERSION_MAJOR >= 9
+        case llvm::AtomicRMWInst::FAdd:
+            return new AtomicGeneric2Op<T>(operand, [](T *b, T a) {
+                F x, y;
+                std::memcpy(&x, b, sizeof(F));
+                std::memcpy(&y, &a, sizeof(F));
+                x += y;
+                std::memcpy(b, &x, sizeof(F));
+            });
+        case llvm::AtomicRMWInst::FSub:
+            return new AtomicGeneric2Op<T>(operand, [](T *b, T a) {
+                F x, y;
+                std::memcpy(&x, b, sizeof(F));
+                std::memcpy(&y, &a, sizeof(F));
+                x -= y;
+                std::memcpy(b, &x, sizeof(F));
+            });
+    #endif
+        case llvm::AtomicRMWInst::Xchg: return new AtomicOpExch<T>(operand);
+        default: return nullptr;
+    }
+}
+
+MemoryRequest *
+AtomicRMW::createMemoryRequest() {
+    Addr memAddr = operands.at(0).getPtrRegValue();
+    size_t reqLen = getSizeInBytes();
+    auto &value = operands.at(1);
+    uint64_t bits = value.getLockedBits();
+    AtomicOpFunctor * op = nullptr;
+    if ((value.getType() == llvm::Type::FloatTyID) || (value.getType() == llvm::Type::DoubleTyID)) {
+        if (reqLen == 4) op = floatAtomicOp<uint32_t, float>(operation, bits);
+        else if (reqLen == 8) op = floatAtomicOp<uint64_t, double>(operation, bits);
+    } else {
+        switch (reqLen) {
+            case 1: op = integerAtomicOp<uint8_t>(operation, bits); break;
+            case 2: op = integerAtomicOp<uint16_t>(operation, bits); break;
+            case 4: op = integerAtomicOp<uint32_t>(operation, bits); break;
+            case 8: op = integerAtomicOp<uint64_t>(operation, bits); break;
+            default: break;
+        }
+    }
+    if (!op) panic("Unsupported atomicrmw: %s\n", getIRString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", getIRString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Addr[%x] Size[%i]\n", memAddr, reqLen);
+    return new MemoryRequest(memAddr, reqLen, op);
+}
+
+// SALAM-CmpXchg // ---------------------------------------------------------//
+void // Debugging Interface
+CmpXchg::dumper() {
+
+}
+
+std::shared_ptr<SALAM::Instruction>
+createCmpXchgInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) {
+    return std::make_shared<SALAM::CmpXchg>(id, owner, dbg, OpCode, cycles, fu);
+}
+
+CmpXchg::CmpXchg(uint64_t id, gem5::SimObject * owner, bool dbg,
+         uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) :
+         Instruction(id, owner, dbg, OpCode, cycles,fu)
+{
+}
+
+void
+CmpXchg::initialize(llvm::Value * irval,
+                irvmap * irmap,
+                SALAM::valueListTy * valueList) {
+    SALAM::Instruction::initialize(irval, irmap, valueList);
+    // ****** //
+    llvm::AtomicCmpXchgInst * inst = llvm::dyn_cast<llvm::AtomicCmpXchgInst>(irval);
+    assert(inst);
+    llvm::Type * compareType = inst->getCompareOperand()->getType();
+    valueBytes = compareType->isPointerTy() ? 8 : (compareType->getScalarSizeInBits() / 8);
+    // Lane 0 holds the loaded value and lane 1 the success flag
+    size = 2 * valueBytes * 8;
+    returnReg = std::make_shared<VectorRegister>(compareType->getTypeID(), 2, valueBytes);
+}
+
+void
+CmpXchg::setAtomicResult(uint8_t * data) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, data, valueBytes);
+    std::static_pointer_cast<SALAM::VectorRegister>(returnReg)->setLane(0, bits);
+}
+
+bool
+CmpXchg::succeeded() {
+    uint64_t mask = (valueBytes >= 8) ? ~0ULL : ((1ULL << (valueBytes * 8)) - 1);
+    auto result = std::static_pointer_cast<SALAM::VectorRegister>(returnReg);
+    return result->getLane(0) == (operands.at(1).getLockedBits() & mask);
+}
+
+void
+CmpXchg::compute() {
+    // Memory performed the conditional swap. Derive the success flag from
+    // the loaded value. Weak exchanges never fail spuriously here
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    auto result = std::static_pointer_cast<SALAM::VectorRegister>(returnReg);
+    result->setLane(1, succeeded() ? 1 : 0);
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s\n", getIRStub(), registerDataString());
+}
+
+MemoryRequest *
+CmpXchg::createMemoryRequest() {
+    Addr memAddr = operands.at(0).getPtrRegValue();
+    uint64_t mask = (valueBytes >= 8) ? ~0ULL : ((1ULL << (valueBytes * 8)) - 1);
+    uint64_t compare = operands.at(1).getLockedBits() & mask;
+    uint64_t swap = operands.at(2).getLockedBits();
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Launching %s\n", getIRString());
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Addr[%x] Size[%i]\n", memAddr, valueBytes);
+    return new MemoryRequest(memAddr, &swap, compare, valueBytes);
+}
+
+// SALAM-ExtractValue // ----------------------------------------------------//
+void // Debugging Interface
+ExtractValue::dumper() {
+
+}
+
+std::shared_ptr<SALAM::Instruction>
+createExtractValueInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) {
+    return std::make_shared<SALAM::ExtractValue>(id, owner, dbg, OpCode, cycles, fu);
+}
+
+ExtractValue::ExtractValue(uint64_t id, gem5::SimObject * owner, bool dbg,
+         uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu) :
+         Instruction(id, owner, dbg, OpCode, cycles,fu)
+{
+}
+
+void
+ExtractValue::initialize(llvm::Value * irval,
+                irvmap * irmap,
+                SALAM::valueListTy * valueList) {
+    SALAM::Instruction::initialize(irval, irmap, valueList);
+    // ****** //
+    llvm::ExtractValueInst * inst = llvm::dyn_cast<llvm::ExtractValueInst>(irval);
+    assert(inst && (inst->getNumIndices() == 1));
+    field = inst->getIndices()[0];
+}
+
+void
+ExtractValue::compute() {
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| Computing %s\n", getIRString());
+    auto aggregate = operands.at(0).getLockedVector();
+    setRegisterValue(aggregate->getLane(field));
+    if (dbg) DPRINTFS(RuntimeCompute, owner, "|| %s = %s.%d = %s\n", getIRStub(),
+        operands.at(0).getIRStub(), field, registerDataString());
 }
 
 } // namespace SALAM
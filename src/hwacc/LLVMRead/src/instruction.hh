@@ -6,7 +6,10 @@
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
+#include <llvm/IR/Function.h>
 #include "basic_block.hh"
+#include "block_jit.hh"
+#include "compute_kernels.hh"
 #include "operand.hh"
 #include "debug_flags.hh"
 #include "value.hh"
@@ -16,6 +19,30 @@
 namespace SALAM {
 
 class BasicBlock; // Required Declaration
+class Instruction;
+// Dynamic instruction queues ordered by scheduling sequence number
+typedef std::map<uint64_t, std::shared_ptr<Instruction>> dynamicQueueTy;
+
+// Properties of a static instruction. Filled in while the static graph is
+// constructed and shared by every dynamic instance cloned from it
+struct StaticInstruction {
+    uint64_t opcode = 0;
+    uint64_t cycles = 0;
+    uint64_t functionalUnit = 0;
+    HWInterface * hw = nullptr;
+    valueListTy dependencies;
+    // Slot in the function register file holding each dependency, or noSlot
+    // when the dependency is produced at runtime. See Function::assignRegisterSlots
+    std::vector<uint64_t> operandSlots;
+    static constexpr uint64_t noSlot = (uint64_t)-1;
+    // Vector width. Lane-wise operations claim a functional unit per lane
+    uint64_t lanes = 1;
+    bool laneWise = false;
+    // Specialized evaluation of scalar arithmetic, compares and casts
+    ComputeKernel kernel = nullptr;
+    // Native code of the instruction when its basic block was JIT compiled
+    JITKernel jit = nullptr;
+};
 
 //---------------------------------------------------------------------------//
 //--------- Instruction Base Class ------------------------------------------//
@@ -25,16 +52,21 @@ class BasicBlock; // Required Declaration
 class Instruction : public Value
 {
     private:
-        std::map<uint64_t, std::shared_ptr<SALAM::Instruction>> dynamicDependencies;
+        // UIDs of producers that have not yet committed. Resolved entries are
+        // swapped out, so the size doubles as the pending dependency counter.
+        std::vector<uint64_t> dynamicDependencies;
         std::vector<std::shared_ptr<SALAM::Instruction>> dynamicUsers;
-        uint64_t llvmOpCode;
-        uint64_t cycleCount;
         uint64_t currentCycle;
-        uint64_t functional_unit = 0;
-        HWInterface* hw_interface;
+        // Functional unit reservation. Pipelined units are handed back after
+        // the initiation interval, others when the instruction commits
+        bool fuHeld = false;
+        uint64_t fuRelease = 0;
+        // Runtime wakeup. Set while the instance waits in a reservation table.
+        uint64_t sequence = 0;
+        dynamicQueueTy * readyQueue = nullptr;
 
     protected:
-        valueListTy staticDependencies;
+        std::shared_ptr<StaticInstruction> staticInst;
         // Operands
         std::vector<SALAM::Operand> operands;
 
@@ -61,27 +93,43 @@ class Instruction : public Value
         virtual void initialize(llvm::Value * irval, irvmap * irmap, SALAM::valueListTy * valueList); //
         virtual std::shared_ptr<SALAM::BasicBlock> getTarget()  { return nullptr; }
         uint64_t getDependencyCount() { return dynamicDependencies.size(); }
-        virtual uint64_t getCycleCount() { return cycleCount; }
-        virtual uint64_t getOpode() { return llvmOpCode; }
+        virtual uint64_t getCycleCount() { return staticInst->cycles; }
+        virtual uint64_t getOpode() { return staticInst->opcode; }
         uint64_t getCurrentCycle() { return currentCycle; }
-        virtual valueListTy getStaticDependencies() const { return staticDependencies; }
-        std::map<uint64_t, std::shared_ptr<SALAM::Instruction>> getDynamicDependencies() const { return dynamicDependencies; }
-        std::shared_ptr<SALAM::Value> getStaticDependencies(int i) const { return staticDependencies.at(i); }
-        std::shared_ptr<SALAM::Value> getDynamicDependencies(int i) const { return dynamicDependencies.at(i); }
-        virtual std::vector<uint64_t> runtimeInitialize();
-        void removeDynamicDependency(uint64_t opuid);
-        void addRuntimeDependency(std::shared_ptr<SALAM::Instruction> dep) {
-            dynamicDependencies.insert({dep->getUID(),dep});
+        virtual valueListTy getStaticDependencies() const { return staticInst->dependencies; }
+        const std::vector<uint64_t> & getDynamicDependencies() const { return dynamicDependencies; }
+        std::shared_ptr<SALAM::Value> getStaticDependencies(int i) const { return staticInst->dependencies.at(i); }
+        // Locks in constant and argument operands, taking them from the
+        // register file of the active function when one is given, and
+        // returns the UIDs of the dependencies still to be produced
+        virtual std::vector<uint64_t> runtimeInitialize(const uint64_t * registers = nullptr);
+        uint64_t getOperandSlot(size_t i) const {
+            return (i < staticInst->operandSlots.size()) ? staticInst->operandSlots[i] : StaticInstruction::noSlot;
         }
+        void setOperandSlots(const std::vector<uint64_t> &slots) { staticInst->operandSlots = slots; }
+        void removeDynamicDependency(uint64_t opuid);
+        bool addRuntimeDependency(std::shared_ptr<SALAM::Instruction> dep);
         void addRuntimeUser(std::shared_ptr<SALAM::Instruction> dep) { dynamicUsers.push_back(dep); }
         void signalUsers();
+        void setReadyQueue(dynamicQueueTy * queue, uint64_t seq) { readyQueue = queue; sequence = seq; }
+        void clearReadyQueue() { readyQueue = nullptr; }
+        uint64_t getSequence() { return sequence; }
         bool isCommitted() { return committed; }
-        //bool hasFunctionalUnit() { return (functional_unit != 0); }
-        bool hasFunctionalUnit() { return false; }
+        // Marks an instance evaluated outside the timing model as committed,
+        // so later instances lock in its value instead of waiting on it
+        void retire() { launched = true; committed = true; }
+        bool hasFunctionalUnit() { return (staticInst->functionalUnit != 0) && (staticInst->hw != nullptr); }
+        bool acquireFunctionalUnit();
+        void releaseFunctionalUnit();
         bool debug() { return dbg; }
         void linkOperands(const SALAM::Operand &newOp);
         std::vector<SALAM::Operand> * getOperands() { return &operands; }
-        uint64_t getFunctionalUnit() { return functional_unit; }
+        uint64_t getFunctionalUnit() { return staticInst->functionalUnit; }
+        uint64_t getLanes() { return staticInst->lanes; }
+        void computeLanes();
+        void computeKernel();
+        void computeJIT();
+        void setJITKernel(JITKernel jit) { staticInst->jit = jit; }
         virtual bool isReturn() { return false; }
         virtual bool isTerminator() { return false; }
         virtual bool isPhi() { return false; }
@@ -89,18 +137,34 @@ class Instruction : public Value
         virtual bool isBr() { return false; }
         virtual bool isLoad() { return false; }
         virtual bool isStore() {return false; }
+        virtual bool isMemoryIntrinsic() { return false; }
+        virtual bool isAtomic() { return false; }
+        virtual bool isCmpXchg() { return false; }
+        // Accepts the value memory held before an atomic update
+        virtual void setAtomicResult(uint8_t * data) { setRegisterValue(data); }
         virtual bool isGEP() { return false; }
         virtual bool launch();
         virtual bool commit();
         virtual bool ready();
         virtual void compute() { }
+        // Evaluates the instruction at once, without modeling its latency
+        void execute() {
+            if (staticInst->jit) computeJIT();
+            else if (staticInst->kernel) computeKernel();
+            else if (staticInst->laneWise) computeLanes();
+            else compute();
+        }
         virtual void reset();
-        virtual void setOperandValue(uint64_t uid);
+        void recycle();
+        virtual void setOperandValue(uint64_t uid, std::shared_ptr<SALAM::Register> source = nullptr);
         virtual void dump() { if (dbg) inst_dbg->dumper(this); }
         virtual bool isInstruction() { return true; }
         virtual bool isLoadingInternal() { return false; }
         virtual bool isLatchingBrExiting() { return false; }
-        // virtual void linkFunctionalUnit(HWInterface * hw_interface);
+        virtual bool isLatchingBr() { return false; }
+        void linkFunctionalUnit(HWInterface * hw) { staticInst->hw = hw; }
+        size_t getDynamicFootprint() const;
+        size_t getStaticFootprint() const;
         std::shared_ptr<SALAM::Instruction> clone() const { return std::static_pointer_cast<SALAM::Instruction>(createClone()); }
         virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::Instruction>(new SALAM::Instruction(*this)); }
         virtual MemoryRequest * createMemoryRequest() { return nullptr; }
@@ -117,8 +181,6 @@ class Instruction : public Value
 class BadInstruction : public Instruction {
     // Used to draw hard dependencies, ie: ret
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
 
     protected:
@@ -151,10 +213,7 @@ createBadInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Ret : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -167,7 +226,6 @@ class Ret : public Instruction {
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
         bool isReturn() override { return true; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -185,14 +243,11 @@ createRetInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Br : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         std::shared_ptr<SALAM::Value> condition;
         std::shared_ptr<SALAM::BasicBlock> defaultDestination;
         std::shared_ptr<SALAM::BasicBlock> trueDestination;
         std::shared_ptr<SALAM::BasicBlock> falseDestination;
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
         bool conditional = false;
         bool isLatching = false;
 
@@ -212,10 +267,10 @@ class Br : public Instruction {
         std::shared_ptr<SALAM::BasicBlock> getTarget() override;
         bool isTerminator() override { return true; }
         bool isBr() override { return true; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void setLatching(bool latch) { isLatching = latch; }
         virtual bool isLatchingBrExiting() override { return isLatching && (getTarget()==trueDestination); }
+        virtual bool isLatchingBr() override { return isLatching; }
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
         std::shared_ptr<SALAM::Br> clone() const { return std::static_pointer_cast<SALAM::Br>(createClone()); }
@@ -234,13 +289,10 @@ typedef std::vector< caseArgs> switchArgs;
 
 class Switch : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         // [0] [Switch Var, Default Dest]
         // [1] [ Case Var, Case Dest ] .... [n]
         switchArgs cases;
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
         std::shared_ptr<SALAM::BasicBlock> defaultDestination;
     protected:
     public:
@@ -256,7 +308,6 @@ class Switch : public Instruction {
         // std::shared_ptr<SALAM::Value> destination(int switchVar);
         std::shared_ptr<SALAM::BasicBlock> getTarget() override;
         bool isTerminator() override { return true; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -278,10 +329,7 @@ createSwitchInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 class Add : public Instruction
 {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -293,7 +341,6 @@ class Add : public Instruction
         void initialize(llvm::Value *irval,
                         SALAM::irvmap *irmap,
                         SALAM::valueListTy *valueList) override;
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -311,10 +358,7 @@ createAddInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FAdd : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -326,7 +370,6 @@ class FAdd : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -343,10 +386,7 @@ createFAddInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Sub : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -358,7 +398,6 @@ class Sub : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -375,10 +414,7 @@ createSubInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FSub : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -390,7 +426,6 @@ class FSub : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -407,11 +442,8 @@ createFSubInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Mul : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::APIntRegister *op1, *op2;
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -423,7 +455,6 @@ class Mul : public Instruction {
         void initialize (llvm::Value * irval,
                         SALAM::irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -440,10 +471,7 @@ createMulInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FMul : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -455,7 +483,6 @@ class FMul : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -472,10 +499,7 @@ createFMulInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class UDiv : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -487,7 +511,6 @@ class UDiv : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -504,10 +527,7 @@ createUDivInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class SDiv : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -519,7 +539,6 @@ class SDiv : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -536,10 +555,7 @@ createSDivInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FDiv : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -551,7 +567,6 @@ class FDiv : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -568,10 +583,7 @@ createFDivInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class URem : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -583,7 +595,6 @@ class URem : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -600,10 +611,7 @@ createURemInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class SRem : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -615,7 +623,6 @@ class SRem : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -632,10 +639,7 @@ createSRemInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FRem : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -647,7 +651,6 @@ class FRem : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -668,10 +671,7 @@ createFRemInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Shl : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -683,7 +683,6 @@ class Shl : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -700,10 +699,7 @@ createShlInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class LShr : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -715,7 +711,6 @@ class LShr : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -732,10 +727,7 @@ createLShrInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class AShr : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -747,7 +739,6 @@ class AShr : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -764,10 +755,7 @@ createAShrInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class And : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -779,7 +767,6 @@ class And : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -796,10 +783,7 @@ createAndInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Or : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
     protected:
 
     public:
@@ -811,7 +795,6 @@ class Or : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -828,10 +811,7 @@ createOrInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Xor : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -843,7 +823,6 @@ class Xor : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -864,11 +843,8 @@ createXorInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Load : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         uint64_t align;
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
         bool loadingInternal = false;
 
     protected:
@@ -882,7 +858,6 @@ class Load : public Instruction {
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
         bool isLoad() override { return true; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void loadInternal();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
@@ -903,11 +878,8 @@ createLoadInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Store : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         uint64_t align;
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -920,7 +892,6 @@ class Store : public Instruction {
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
         bool isStore() override { return true; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -946,7 +917,6 @@ The GEP indecies will by APSInts, so cast to int64_t for calculating offset insi
 
 class GetElementPtr : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
         std::vector<int64_t> offsets;
         std::vector<bool> offsetOfStruct;
         SALAM::Debugger *dbgr;
@@ -966,7 +936,6 @@ class GetElementPtr : public Instruction {
                         SALAM::valueListTy * valueList);
         GetElementPtr &setA() { std::cout << "a\n"; return *this; }
         GetElementPtr &setB() { std::cout << "b\n"; return *this; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         virtual bool isGEP() override { return true; }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
@@ -988,10 +957,7 @@ createGetElementPtrInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Trunc : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1003,7 +969,6 @@ class Trunc : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1020,10 +985,7 @@ createTruncInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class ZExt : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1035,7 +997,6 @@ class ZExt : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1052,10 +1013,7 @@ createZExtInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class SExt : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1067,7 +1025,6 @@ class SExt : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1086,10 +1043,7 @@ void initializeFPToUIInst(SALAM::FPToUI &salamInstruction);
 
 class FPToUI : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1101,7 +1055,6 @@ class FPToUI : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1118,10 +1071,7 @@ createFPToUIInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FPToSI : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
 
@@ -1134,7 +1084,6 @@ class FPToSI : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1151,10 +1100,7 @@ createFPToSIInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class UIToFP : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1166,7 +1112,6 @@ class UIToFP : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1183,10 +1128,7 @@ createUIToFPInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class SIToFP : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1198,7 +1140,6 @@ class SIToFP : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1215,10 +1156,7 @@ createSIToFPInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FPTrunc : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1230,7 +1168,6 @@ class FPTrunc : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1247,10 +1184,7 @@ createFPTruncInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FPExt : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1262,7 +1196,6 @@ class FPExt : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1279,10 +1212,7 @@ createFPExtInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class PtrToInt : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
 
@@ -1295,7 +1225,6 @@ class PtrToInt : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1312,10 +1241,7 @@ createPtrToIntInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class IntToPtr : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1327,7 +1253,6 @@ class IntToPtr : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1343,10 +1268,7 @@ createIntToPtrInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class BitCast : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1358,7 +1280,6 @@ class BitCast : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1380,11 +1301,8 @@ createBitCastInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class ICmp : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
         uint64_t predicate;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
 
@@ -1397,7 +1315,6 @@ class ICmp : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1414,11 +1331,8 @@ createICmpInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class FCmp : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
         uint64_t predicate;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
 
@@ -1431,7 +1345,6 @@ class FCmp : public Instruction {
         void initialize (llvm::Value * irval,
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1457,12 +1370,9 @@ typedef std::map<std::shared_ptr<SALAM::BasicBlock>, std::shared_ptr<SALAM::Valu
 
 class Phi : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         std::shared_ptr<SALAM::BasicBlock> previousBB;
-        phiArgsTy phiArgs; // [BasicBlock, Value]
+        std::shared_ptr<phiArgsTy> phiArgs; // [BasicBlock, Value], shared by all instances
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
 
@@ -1476,10 +1386,9 @@ class Phi : public Instruction {
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
         //virtual std::deque<uint64_t> runtimeInitialize() override;
-        virtual std::vector<uint64_t> runtimeInitialize() override;
+        virtual std::vector<uint64_t> runtimeInitialize(const uint64_t * registers = nullptr) override;
         bool isPhi() override { return true; }
         void setPrevBB(std::shared_ptr<SALAM::BasicBlock> prevBB);
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         virtual valueListTy getStaticDependencies() const override;
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
@@ -1495,13 +1404,27 @@ createPHIInst(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t fu);
 // SALAM-Call // ------------------------------------------------------------//
 
+// LLVM intrinsics executed by the runtime in place of a function call
+enum class IntrinsicKind {
+    None,       // Call to a defined function
+    Unsupported,
+    NoOp,       // Markers without a hardware effect, e.g. lifetime and debug info
+    MemCopy,    // memcpy and memmove, a read burst followed by a write burst
+    MemSet,     // memset, a single write burst
+    FMulAdd,
+    Sqrt,
+    FAbs,
+    MinNum,
+    MaxNum
+};
+
+IntrinsicKind lookupIntrinsic(const llvm::Function * callee);
+
 class Call : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
         std::shared_ptr<SALAM::Value> callee;
+        IntrinsicKind intrinsic = IntrinsicKind::None;
     protected:
     public:
         Call (uint64_t id, gem5::SimObject * owner, bool dbg,
@@ -1513,11 +1436,25 @@ class Call : public Instruction {
                         irvmap * irmap,
                         SALAM::valueListTy * valueList);
         bool isCall() override { return true; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
         std::shared_ptr<SALAM::Value> getCalleeValue() { return callee; }
+        IntrinsicKind getIntrinsic() { return intrinsic; }
+        bool isIntrinsic() { return intrinsic != IntrinsicKind::None; }
+        bool isMemoryIntrinsic() override {
+            return (intrinsic == IntrinsicKind::MemCopy) || (intrinsic == IntrinsicKind::MemSet);
+        }
+        // Bulk intrinsics take (dest, src or value, length, ...) operands
+        uint64_t getBurstDestination() { return operands.at(0).getPtrRegValue(); }
+        uint64_t getBurstSource() { return operands.at(1).getPtrRegValue(); }
+    #if USE_LLVM_AP_VALUES
+        size_t getBurstLength() { return operands.at(2).getIntRegValue().getZExtValue(); }
+    #else
+        size_t getBurstLength() { return operands.at(2).getUIntRegValue(); }
+    #endif
+        MemoryRequest * createMemoryRequest() override;
+        MemoryRequest * createWriteBurst(const uint8_t * data);
         std::shared_ptr<SALAM::Call> clone() const { return std::static_pointer_cast<SALAM::Call>(createClone()); }
         virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::Call>(new SALAM::Call(*this)); }
 };
@@ -1531,13 +1468,10 @@ createCallInst(uint64_t id, gem5::SimObject * owner, bool dbg,
 
 class Select : public Instruction {
     private:
-        std::vector< std::vector<uint64_t> > conditions;
-        // conditions.at[0] == base params
         std::shared_ptr<SALAM::Value> condition;
         std::shared_ptr<SALAM::Value> trueValue;
         std::shared_ptr<SALAM::Value> falseValue;
         SALAM::Debugger *dbgr;
-        uint64_t currentCycle;
 
     protected:
     public:
@@ -1552,7 +1486,6 @@ class Select : public Instruction {
                         SALAM::valueListTy * valueList);
         // std::shared_ptr<SALAM::Value> evaluate();
         // bool isTerminator() override { return true; }
-        uint64_t getCycleCount() { return conditions.at(0).at(2); }
         void compute();
         void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
         void dumper();
@@ -1565,6 +1498,204 @@ createSelectInst(uint64_t id, gem5::SimObject * owner, bool dbg,
               uint64_t OpCode,
               uint64_t cycles,
               uint64_t fu);
+
+//---------------------------------------------------------------------------//
+//--------- Vector Instructions ---------------------------------------------//
+//---------------------------------------------------------------------------//
+
+// SALAM-ExtractElement // --------------------------------------------------//
+
+class ExtractElement : public Instruction {
+    private:
+        SALAM::Debugger *dbgr;
+
+    protected:
+    public:
+        ExtractElement(uint64_t id, gem5::SimObject * owner, bool dbg,
+            uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+        ~ExtractElement() = default;
+        void initialize (llvm::Value * irval,
+                        irvmap * irmap,
+                        SALAM::valueListTy * valueList);
+        void compute();
+        void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
+        void dumper();
+        std::shared_ptr<SALAM::ExtractElement> clone() const { return std::static_pointer_cast<SALAM::ExtractElement>(createClone()); }
+        virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::ExtractElement>(new SALAM::ExtractElement(*this)); }
+};
+
+std::shared_ptr<SALAM::Instruction>
+createExtractElementInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+
+// SALAM-InsertElement // ---------------------------------------------------//
+
+class InsertElement : public Instruction {
+    private:
+        SALAM::Debugger *dbgr;
+
+    protected:
+    public:
+        InsertElement(uint64_t id, gem5::SimObject * owner, bool dbg,
+            uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+        ~InsertElement() = default;
+        void initialize (llvm::Value * irval,
+                        irvmap * irmap,
+                        SALAM::valueListTy * valueList);
+        void compute();
+        void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
+        void dumper();
+        std::shared_ptr<SALAM::InsertElement> clone() const { return std::static_pointer_cast<SALAM::InsertElement>(createClone()); }
+        virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::InsertElement>(new SALAM::InsertElement(*this)); }
+};
+
+std::shared_ptr<SALAM::Instruction>
+createInsertElementInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+
+// SALAM-ShuffleVector // ---------------------------------------------------//
+
+class ShuffleVector : public Instruction {
+    private:
+        // Source lane of each result lane, -1 for undefined lanes. Shared
+        // by every dynamic instance
+        std::shared_ptr<const std::vector<int>> mask;
+        SALAM::Debugger *dbgr;
+
+    protected:
+    public:
+        ShuffleVector(uint64_t id, gem5::SimObject * owner, bool dbg,
+            uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+        ~ShuffleVector() = default;
+        void initialize (llvm::Value * irval,
+                        irvmap * irmap,
+                        SALAM::valueListTy * valueList);
+        void compute();
+        void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
+        void dumper();
+        std::shared_ptr<SALAM::ShuffleVector> clone() const { return std::static_pointer_cast<SALAM::ShuffleVector>(createClone()); }
+        virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::ShuffleVector>(new SALAM::ShuffleVector(*this)); }
+};
+
+std::shared_ptr<SALAM::Instruction>
+createShuffleVectorInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+//---------------------------------------------------------------------------//
+//--------- Atomic Instructions ---------------------------------------------//
+//---------------------------------------------------------------------------//
+
+// SALAM-AtomicRMW // -------------------------------------------------------//
+
+class AtomicRMW : public Instruction {
+    private:
+        llvm::AtomicRMWInst::BinOp operation;
+        SALAM::Debugger *dbgr;
+
+    protected:
+    public:
+        AtomicRMW(uint64_t id, gem5::SimObject * owner, bool dbg,
+            uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+        ~AtomicRMW() = default;
+        void initialize (llvm::Value * irval,
+                        irvmap * irmap,
+                        SALAM::valueListTy * valueList);
+        bool isAtomic() override { return true; }
+        void compute();
+        void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
+        void dumper();
+        std::shared_ptr<SALAM::AtomicRMW> clone() const { return std::static_pointer_cast<SALAM::AtomicRMW>(createClone()); }
+        virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::AtomicRMW>(new SALAM::AtomicRMW(*this)); }
+
+        MemoryRequest * createMemoryRequest() override;
+};
+
+std::shared_ptr<SALAM::Instruction>
+createAtomicRMWInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+// SALAM-CmpXchg // ---------------------------------------------------------//
+
+// The { loaded value, success } result pair is held packed in a two lane
+// register and read back with extractvalue
+class CmpXchg : public Instruction {
+    private:
+        size_t valueBytes = 0;
+        SALAM::Debugger *dbgr;
+
+    protected:
+    public:
+        CmpXchg(uint64_t id, gem5::SimObject * owner, bool dbg,
+            uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+        ~CmpXchg() = default;
+        void initialize (llvm::Value * irval,
+                        irvmap * irmap,
+                        SALAM::valueListTy * valueList);
+        bool isAtomic() override { return true; }
+        bool isCmpXchg() override { return true; }
+        size_t getValueBytes() { return valueBytes; }
+        void setAtomicResult(uint8_t * data) override;
+        void compute();
+        bool succeeded();
+        void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
+        void dumper();
+        std::shared_ptr<SALAM::CmpXchg> clone() const { return std::static_pointer_cast<SALAM::CmpXchg>(createClone()); }
+        virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::CmpXchg>(new SALAM::CmpXchg(*this)); }
+
+        MemoryRequest * createMemoryRequest() override;
+};
+
+std::shared_ptr<SALAM::Instruction>
+createCmpXchgInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+// SALAM-ExtractValue // ----------------------------------------------------//
+
+// Only the results of cmpxchg are aggregates in the datapath
+class ExtractValue : public Instruction {
+    private:
+        unsigned field = 0;
+        SALAM::Debugger *dbgr;
+
+    protected:
+    public:
+        ExtractValue(uint64_t id, gem5::SimObject * owner, bool dbg,
+            uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
+        ~ExtractValue() = default;
+        void initialize (llvm::Value * irval,
+                        irvmap * irmap,
+                        SALAM::valueListTy * valueList);
+        void compute();
+        void dump() { if (dbgr->enabled()) { dumper(); inst_dbg->dumper(static_cast<SALAM::Instruction*>(this));}}
+        void dumper();
+        std::shared_ptr<SALAM::ExtractValue> clone() const { return std::static_pointer_cast<SALAM::ExtractValue>(createClone()); }
+        virtual std::shared_ptr<SALAM::Value> createClone() const override { return std::shared_ptr<SALAM::ExtractValue>(new SALAM::ExtractValue(*this)); }
+};
+
+std::shared_ptr<SALAM::Instruction>
+createExtractValueInst(uint64_t id, gem5::SimObject * owner, bool dbg,
+              uint64_t OpCode,
+              uint64_t cycles,
+              uint64_t fu);
 //---------------------------------------------------------------------------//
 //--------- End Instruction Classes -----------------------------------------//
 //---------------------------------------------------------------------------//
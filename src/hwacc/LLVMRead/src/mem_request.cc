@@ -2,8 +2,55 @@
 #include "mem_request.hh"
 #include <sstream>
 #include <iomanip>
+#include <vector>
 //------------------------------------------//
 
+namespace {
+// Released requests waiting for reuse, kept per thread so no locking is
+// needed. A request released on another thread's event queue lands in that
+// thread's list, so each list is capped instead of growing without bound
+const size_t requestFreeListCap = 1024;
+struct RequestFreeList {
+    std::vector<void *> free;
+    ~RequestFreeList() {
+        for (auto ptr : free) ::operator delete(ptr);
+    }
+};
+thread_local RequestFreeList requestFreeList;
+}
+
+void *
+MemoryRequest::operator new(size_t size) {
+    auto &free = requestFreeList.free;
+    // Only blocks of exactly a MemoryRequest are recycled
+    if ((size != sizeof(MemoryRequest)) || free.empty()) return ::operator new(size);
+    void * ptr = free.back();
+    free.pop_back();
+    return ptr;
+}
+
+void
+MemoryRequest::operator delete(void * ptr, size_t size) {
+    if (!ptr) return;
+    auto &free = requestFreeList.free;
+    if ((size != sizeof(MemoryRequest)) || (free.size() >= requestFreeListCap)) {
+        ::operator delete(ptr);
+        return;
+    }
+    free.push_back(ptr);
+}
+
+void
+MemoryRequest::allocateBuffers(size_t len) {
+    if (len <= inlineSize) {
+        buffer = inlineBuffer;
+        readsDone = inlineReadsDone;
+    } else {
+        buffer = new uint8_t[len];
+        readsDone = new bool[len];
+    }
+}
+
 MemoryRequest::MemoryRequest(Addr add, size_t len) {
     address = add;
     length = len;
@@ -19,13 +66,9 @@ MemoryRequest::MemoryRequest(Addr add, size_t len) {
     totalLength = length;
     readDone = 0;
 
-    buffer = new uint8_t[length];
-    readsDone = new bool[length];
+    allocateBuffers(length);
     std::memset(buffer, 0, length);
-
-    for (int i = 0; i < length; i++) {
-        readsDone[i] = false;
-    }
+    std::memset(readsDone, 0, length * sizeof(bool));
     pkt = NULL;
 }
 
@@ -48,8 +91,7 @@ MemoryRequest::MemoryRequest(Addr add, const void *data, size_t len) {
     readDone = length;
     writeDone = 0;
 
-    buffer = new uint8_t[length];
-    readsDone = new bool[length];
+    allocateBuffers(length);
     std::memcpy(buffer, data, length);
     // for (int i = 0; i < length; i++) {
     //     buffer[i] = *(data + i);
@@ -58,6 +100,19 @@ MemoryRequest::MemoryRequest(Addr add, const void *data, size_t len) {
     pkt = NULL;
 }
 
+MemoryRequest::MemoryRequest(Addr add, size_t len, AtomicOpFunctor *op) :
+    MemoryRequest(add, len) {
+    atomicOp.reset(op);
+}
+
+MemoryRequest::MemoryRequest(Addr add, const void *data, uint64_t compare, size_t len) :
+    MemoryRequest(add, len) {
+    // The swap value rides in the buffer and is replaced by the response
+    std::memcpy(buffer, data, length);
+    condSwap = true;
+    compareValue = compare;
+}
+
 std::string
 MemoryRequest::printBuffer() {
     std::stringstream ss;
@@ -1,9 +1,13 @@
 #ifndef MEMORY_REQUEST_HH
 #define MEMORY_REQUEST_HH
 //------------------------------------------//
+#include "base/amo.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "debug_flags.hh"
+
+#include <memory>
+#include <vector>
 //------------------------------------------//
 
 using namespace gem5;
@@ -27,21 +31,46 @@ class MemoryRequest {
 
     uint8_t *buffer;
     bool *readsDone;
+    // Requests up to inlineSize bytes keep their payload and completion
+    // flags inline rather than on the heap
+    static const size_t inlineSize = 64;
+    uint8_t inlineBuffer[inlineSize];
+    bool inlineReadsDone[inlineSize];
+    void allocateBuffers(size_t len);
 
     PacketPtr pkt;
     RequestPort * port;
+    // Requests merged into this burst by the CommInterface coalescer
+    std::vector<MemoryRequest *> coalesced;
+
+    // Atomic read-modify-writes travel as a single swap packet. The buffer
+    // returns the value held in memory before the update
+    AtomicOpFunctorPtr atomicOp;
+    bool condSwap = false;
+    uint64_t compareValue = 0;
   public:
     MemoryRequest(Addr add, size_t len);
     MemoryRequest(Addr add, const void *data, size_t len);
+    // Atomic operation applied at the memory side. Takes ownership of op
+    MemoryRequest(Addr add, size_t len, AtomicOpFunctor *op);
+    // Compare and swap, data is written only if memory holds compare
+    MemoryRequest(Addr add, const void *data, uint64_t compare, size_t len);
     ~MemoryRequest() {
-        delete[] readsDone;
-        delete[] buffer;
+        if (buffer != inlineBuffer) {
+            delete[] readsDone;
+            delete[] buffer;
+        }
         // if (pkt) delete pkt;
     }
+    // Requests are recycled through a bounded free list instead of the heap
+    static void * operator new(size_t size);
+    static void operator delete(void * ptr, size_t size);
     void setCarrierPort(RequestPort * _port) { port = _port; }
     RequestPort * getCarrierPort() { return port; }
     uint8_t * getBuffer() { return buffer; }
     Addr getAddress() { return address; }
+    size_t getLength() { return length; }
+    bool isAtomic() { return atomicOp || condSwap; }
     std::string printBuffer();
 };
 
@@ -18,7 +18,21 @@ SALAM::Constant::initialize(llvm::Value * irval,
     llvm::ConstantData * cd = llvm::dyn_cast<llvm::ConstantData>(irval);
     llvm::ConstantExpr * ce = llvm::dyn_cast<llvm::ConstantExpr>(irval);
     llvm::Type *irtype = irval->getType();
-    if (cd) {
+    if (irtype->isVectorTy()) {
+        // Vector constants are filled lane by lane. Undefined lanes read as zero
+        auto vec = std::static_pointer_cast<VectorRegister>(returnReg);
+        vec->setTracked(false);
+        llvm::Constant * cv = llvm::dyn_cast<llvm::Constant>(irval);
+        for (unsigned lane = 0; cv && (lane < vec->getLanes()); lane++) {
+            llvm::Constant * elem = cv->getAggregateElement(lane);
+            if (!elem) continue;
+            if (auto in = llvm::dyn_cast<llvm::ConstantInt>(elem)) {
+                vec->setLane(lane, in->getValue().getLimitedValue());
+            } else if (auto fp = llvm::dyn_cast<llvm::ConstantFP>(elem)) {
+                vec->setLane(lane, fp->getValueAPF().bitcastToAPInt().getLimitedValue());
+            }
+        }
+    } else if (cd) {
         // The constant is a llvm::ConstantData.
         // Get it's value and store it in constValue
         if (irtype->isFloatingPointTy()) {
@@ -348,8 +362,8 @@ SALAM::Operand::Operand_Debugger::dumper(Operand * op)
 SALAM::Operand::Operand(const SALAM::Operand &copy_val):
            SALAM::Value(copy_val)
 {
-    lockedValue = copy_val.lockedValue;
-    set = copy_val.set;
+    lockedData = copy_val.lockedData;
+    lockedVector = copy_val.lockedVector;
 }
 
 // copy constructor from base
@@ -373,26 +387,22 @@ SALAM::Operand::operator = (SALAM::Operand &copy_val)
       returnReg = copy_val.returnReg;
     valueTy = copy_val.valueTy;
     size = copy_val.size;
-    lockedValue = copy_val.lockedValue;
-    set = copy_val.set;
+    lockedData = copy_val.lockedData;
+    lockedVector = copy_val.lockedVector;
     return *this;
 }
 
 void
 SALAM::Operand::initOperandReg()
 {
+    // Scalars are locked into lockedData and need no register of their own
     bool istracked = false;
-    if (returnReg->isPtr()) {
-        if (dbg) DPRINTFS(Runtime, owner, "Operand Ptr Register Initialized\n");
-        lockedValue = std::make_shared<PointerRegister>(istracked);
-    } else if (returnReg->isInt()) {
-        if (dbg) DPRINTFS(Runtime, owner, "Operand Int Register Initialized\n");
-        lockedValue = std::make_shared<APIntRegister>(size, istracked);
-    } else if (returnReg->isFP()) {
-        if (dbg) DPRINTFS(Runtime, owner, "Operand FP Register Initialized\n");
-        lockedValue =
-            std::make_shared<APFloatRegister>(valueTy, istracked);
-    } else {
+    if (returnReg->isVector()) {
+        if (dbg) DPRINTFS(Runtime, owner, "Operand Vector Register Initialized\n");
+        auto vec = std::static_pointer_cast<VectorRegister>(returnReg);
+        lockedVector = std::make_shared<VectorRegister>(vec->getLaneType(),
+            vec->getLanes(), vec->getLaneBytes(), istracked);
+    } else if (!returnReg->isPtr() && !returnReg->isInt() && !returnReg->isFP()) {
         if (dbg) DPRINTFS(Runtime, owner, "Invalid register type. Dumping Operand details\n");
         dump();
         assert(0); // Type is invalid for a register
@@ -406,14 +416,21 @@ SALAM::Operand::initialize(llvm::Value * irval, SALAM::irvmap * irmap)
 }
 
 void
-SALAM::Operand::updateOperandRegister() {
-    assert(lockedValue);
-    if (lockedValue->isPtr()) {
-        lockedValue->writePtrData(returnReg->getPtrData(true),
-                                  getSizeInBytes());
-    } else if (lockedValue->isInt()) {
-        lockedValue->writeIntData(returnReg->getIntData(true));
-    } else if (lockedValue->isFP()) {
-        lockedValue->writeFloatData(returnReg->getFloatData(true));
+SALAM::Operand::updateOperandRegister(std::shared_ptr<SALAM::Register> source) {
+    auto &reg = source ? source : returnReg;
+    if (lockedVector) {
+        lockedVector->writeVectorData(reg->getVectorData(true), getSizeInBytes());
+        return;
+    }
+#if USE_LLVM_AP_VALUES
+    if (reg->isPtr()) {
+        lockedData = reg->getPtrData(true);
+    } else if (reg->isInt()) {
+        lockedData = reg->getIntData(true).getZExtValue();
+    } else {
+        lockedData = reg->getFloatData(true).bitcastToAPInt().getZExtValue();
     }
+#else
+    lockedData = reg->getRawData(true);
+#endif
 }
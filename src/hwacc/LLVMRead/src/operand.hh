@@ -11,6 +11,7 @@
 #include "debug_flags.hh"
 #include "value.hh"
 #include "registers.hh"
+#include <cstring>
 #include <map>
 #include <memory>
 #include <vector>
@@ -19,11 +20,17 @@ namespace SALAM
 {
 
 
-class Operand: public Value
+/*****************************************************************************
+* Operand holds the value of a dependency as locked in by one dynamic
+* instruction. Scalar values are kept as raw bits inside the operand, so the
+* compute functions read them with a plain load. Vector and aggregate values
+* keep a private vector register.
+*****************************************************************************/
+class Operand final: public Value
 {
     private:
-        std::shared_ptr<SALAM::Register> lockedValue;
-        bool set = false;
+        uint64_t lockedData = 0;
+        std::shared_ptr<SALAM::VectorRegister> lockedVector;
 
     protected:
         class Operand_Debugger: public Debugger
@@ -46,25 +53,49 @@ class Operand: public Value
         ~Operand() = default;
         //Value *clone() { return new Operand(*this); }
         virtual void initialize(llvm::Value * irval, irvmap * irmap) override;
-        void updateOperandRegister();
+        // Lock in the value of source, or of the referenced value when not given
+        void updateOperandRegister(std::shared_ptr<SALAM::Register> source = nullptr);
+        // Lock in raw scalar bits, e.g. from a function register file
+        void lockValue(uint64_t bits) { lockedData = bits; }
+        uint64_t getLockedBits() { return lockedData; }
+        // The locked value in memory order, as taken by setRegisterValue
+        const uint8_t * getLockedData() {
+            if (lockedVector) return lockedVector->getVectorData(false);
+            return (const uint8_t *)&lockedData;
+        }
+        std::shared_ptr<SALAM::VectorRegister> getLockedVector() { return lockedVector; }
 
-        virtual uint64_t getPtrRegValue() { return lockedValue->getPtrData(); }
+        virtual uint64_t getPtrRegValue() override { return lockedData; }
     #if USE_LLVM_AP_VALUES
-        virtual llvm::APFloat getFloatRegValue() { return lockedValue->getFloatData(); }
-        virtual llvm::APSInt getIntRegValue() { return lockedValue->getIntData(); }
-        virtual bool hasIntVal() { return lockedValue->isInt(); }
-        virtual bool hasPtrVal() { return lockedValue->isPtr(); }
+        virtual llvm::APFloat getFloatRegValue() override {
+            if (valueTy == llvm::Type::FloatTyID)
+                return llvm::APFloat(llvm::APFloat::IEEEsingle(), llvm::APInt(32, lockedData));
+            return llvm::APFloat(llvm::APFloat::IEEEdouble(), llvm::APInt(64, lockedData));
+        }
+        virtual llvm::APSInt getIntRegValue() override {
+            return llvm::APSInt(llvm::APInt(size, lockedData));
+        }
     #else
-        virtual uint64_t getFloatRegValue() { return lockedValue->getFloatData(); }
-        virtual float getFloatFromReg() { return lockedValue->getFloat(); }
-        virtual double getDoubleFromReg() { return lockedValue->getDouble(); }
-        virtual uint64_t getIntRegValue() { return lockedValue->getIntData(); }
-        virtual uint64_t getUIntRegValue() { return lockedValue->getUnsignedInt(); }
-        virtual int64_t getSIntRegValue() { return lockedValue->getSignedInt(size); }
-        virtual bool hasIntVal() { return lockedValue->isInt(); }
-        virtual bool hasPtrVal() { return lockedValue->isPtr(); }
+        virtual uint64_t getFloatRegValue() override { return lockedData; }
+        virtual float getFloatFromReg() override {
+            float tmp;
+            std::memcpy(&tmp, &lockedData, sizeof(float));
+            return tmp;
+        }
+        virtual double getDoubleFromReg() override {
+            double tmp;
+            std::memcpy(&tmp, &lockedData, sizeof(double));
+            return tmp;
+        }
+        virtual uint64_t getIntRegValue() override { return lockedData; }
+        virtual uint64_t getUIntRegValue() override { return lockedData; }
+        virtual int64_t getSIntRegValue() override {
+            if ((size == 0) || (size >= 64)) return (int64_t)lockedData;
+            return ((int64_t)(lockedData << (64 - size))) >> (64 - size);
+        }
     #endif
-        std::shared_ptr<SALAM::Register> getOpRegister() { return lockedValue; }
+        bool hasIntVal() { return valueTy == llvm::Type::IntegerTyID; }
+        bool hasPtrVal() { return valueTy == llvm::Type::PointerTyID; }
 };
 
 class Constant: public Value {
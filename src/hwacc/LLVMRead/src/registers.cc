@@ -1,6 +1,8 @@
 //------------------------------------------//
 #include "registers.hh"
 //------------------------------------------//
+#include <algorithm>
+#include <cstring>
 
 SALAM::Register::Register(bool trk,
                           bool nul) :
@@ -184,6 +186,31 @@ SALAM::APIntRegister::APIntRegister(const llvm::APInt &RHS) :
     #endif
 }
 
+SALAM::VectorRegister::VectorRegister(llvm::Type * T,
+                                      bool tracked) :
+                                      Register(tracked)
+{
+    llvm::Type * laneType = T->getScalarType();
+    laneTy = laneType->getTypeID();
+    lanes = vectorLanes(T);
+    // Pointer lanes use the 64-bit address space, i1 lanes take a byte
+    if (laneType->isPointerTy()) laneBytes = 8;
+    else laneBytes = ((laneType->getScalarSizeInBits() - 1) >> 3) + 1;
+    data.assign(lanes * laneBytes, 0);
+}
+
+SALAM::VectorRegister::VectorRegister(llvm::Type::TypeID laneT,
+                                      size_t laneCount,
+                                      size_t laneSize,
+                                      bool tracked) :
+                                      Register(tracked),
+                                      laneTy(laneT),
+                                      lanes(laneCount),
+                                      laneBytes(laneSize)
+{
+    data.assign(lanes * laneBytes, 0);
+}
+
 SALAM::PointerRegister::PointerRegister(bool tracked,
                                         bool isNull) :
                                         Register(tracked,
@@ -199,6 +226,7 @@ SALAM::PointerRegister::PointerRegister(uint64_t val,
                                         isNull),
                                         pointer(val)
 {
+    regdata = pointer;
 }
 
 #if USE_LLVM_AP_VALUES
@@ -314,6 +342,43 @@ SALAM::PointerRegister::PointerRegister(uint64_t val,
         regdata = data;
     }
 #endif
+const uint8_t *
+SALAM::VectorRegister::getVectorData(bool incReads)
+{
+    if (incReads && tracked) reads++;
+    return data.data();
+}
+
+void
+SALAM::VectorRegister::writeVectorData(const uint8_t * vec, size_t len, bool incWrites)
+{
+    if (incWrites && tracked) writes++;
+    std::memcpy(data.data(), vec, std::min(len, data.size()));
+}
+
+uint8_t *
+SALAM::VectorRegister::writableData(bool incWrites)
+{
+    if (incWrites && tracked) writes++;
+    return data.data();
+}
+
+uint64_t
+SALAM::VectorRegister::getLane(size_t lane)
+{
+    assert(lane < lanes);
+    uint64_t val = 0;
+    std::memcpy(&val, &data[lane * laneBytes], laneBytes);
+    return val;
+}
+
+void
+SALAM::VectorRegister::setLane(size_t lane, uint64_t val)
+{
+    assert(lane < lanes);
+    std::memcpy(&data[lane * laneBytes], &val, laneBytes);
+}
+
 uint64_t
 SALAM::PointerRegister::getPtrData(bool incReads)
 {
@@ -365,4 +430,19 @@ SALAM::PointerRegister::dataString() {
     ss << "0x" << std::hex << pointer;
 #endif
     return ss.str();
-}
\ No newline at end of file
+}
+
+std::string
+SALAM::VectorRegister::dataString() {
+    std::stringstream ss;
+    ss << "<";
+    for (size_t lane = 0; lane < lanes; lane++) {
+        if (lane > 0) ss << ", ";
+        uint64_t bits = getLane(lane);
+        if (laneTy == llvm::Type::FloatTyID) ss << *(float *)&bits;
+        else if (laneTy == llvm::Type::DoubleTyID) ss << *(double *)&bits;
+        else ss << "0x" << std::hex << bits << std::dec;
+    }
+    ss << ">";
+    return ss.str();
+}
@@ -5,14 +5,28 @@
 #include "llvm/IR/Value.h"
 #include "llvm/IR/GlobalVariable.h"
 #include "llvm/IR/Constants.h"
+#include "llvm/IR/DerivedTypes.h"
 #include "llvm/ADT/APSInt.h"
 #include "llvm/ADT/APFloat.h"
 #include <llvm-c/Core.h>
 
+#include <vector>
+
 #define USE_LLVM_AP_VALUES 0
 
 namespace SALAM
 {
+// Number of lanes in a fixed width vector type
+inline unsigned
+vectorLanes(llvm::Type *T)
+{
+#if (LLVM_VERSION_MAJOR <= 10)
+    return llvm::cast<llvm::VectorType>(T)->getNumElements();
+#else
+    return llvm::cast<llvm::FixedVectorType>(T)->getNumElements();
+#endif
+}
+
 /*****************************************************************************
 * Register is the data storage container for SALAM::Values.
 * Every instruction and function argument has a corresponding register that
@@ -27,7 +41,7 @@ class Register
         bool dbg = false;
         uint64_t reads = 0;
         uint64_t writes = 0;
-        uint64_t regdata;
+        uint64_t regdata = 0;
 
         class Register_Debugger: public Debugger
         {
@@ -100,9 +114,17 @@ class Register
         virtual void writePtrData(uint64_t ptr, size_t len=8, bool incWrites=true) {
             assert(0 && "Attempted to write pointer data on non-pointer register");
         }
+        virtual const uint8_t * getVectorData(bool incReads=true) {
+            assert(0 && "Attempted to read vector data from non-vector register");
+            return nullptr;
+        }
+        virtual void writeVectorData(const uint8_t * vec, size_t len, bool incWrites=true) {
+            assert(0 && "Attempted to write vector data on non-vector register");
+        }
         virtual bool isInt() { return false; }
         virtual bool isFP() { return false; }
         virtual bool isPtr() { return false; }
+        virtual bool isVector() { return false; }
         bool isTracked() { return tracked; }
         bool isNull() { return isNULL; }
         void setNull(bool flag) { isNULL = flag; }
@@ -110,6 +132,12 @@ class Register
         void dump() { if (dbg) reg_dbg.dumper(this); }
         uint64_t getReads() { return reads; }
         uint64_t getWrites() { return writes; }
+        // Raw bits of a scalar register, kept in sync by every scalar write.
+        // Lets operands lock a value without dispatching on the register type
+        uint64_t getRawData(bool incReads=true) {
+            if (incReads && tracked) reads++;
+            return regdata;
+        }
         virtual std::string dataString() = 0;
 };
 
@@ -199,5 +227,39 @@ class PointerRegister : public Register
         virtual void writePtrData(uint64_t ptr, size_t len=8, bool incWrites=true) override;
         virtual std::string dataString() override;
 };
+
+/*****************************************************************************
+* VectorRegister holds every lane of a fixed width vector value. Lanes are
+* packed back to back in memory order, so the contents move to and from
+* memory requests without conversion. Reading or writing the whole vector
+* counts as a single register access.
+*****************************************************************************/
+class VectorRegister : public Register
+{
+    private:
+        std::vector<uint8_t> data;
+        llvm::Type::TypeID laneTy;
+        size_t lanes;
+        size_t laneBytes;
+    public:
+        VectorRegister(llvm::Type *T,
+                       bool isTracked=true);
+        VectorRegister(llvm::Type::TypeID laneT,
+                       size_t laneCount,
+                       size_t laneSize,
+                       bool isTracked=true);
+        virtual const uint8_t * getVectorData(bool incReads=true) override;
+        virtual void writeVectorData(const uint8_t * vec, size_t len, bool incWrites=true) override;
+        // Direct access for lane-wise compute. Counts as a full write
+        uint8_t * writableData(bool incWrites=true);
+        uint64_t getLane(size_t lane);
+        void setLane(size_t lane, uint64_t val);
+        llvm::Type::TypeID getLaneType() { return laneTy; }
+        bool hasFPLanes() { return (laneTy == llvm::Type::FloatTyID) || (laneTy == llvm::Type::DoubleTyID); }
+        size_t getLanes() { return lanes; }
+        size_t getLaneBytes() { return laneBytes; }
+        virtual bool isVector() override { return true; }
+        virtual std::string dataString() override;
+};
 } // End SALAM Namespace
 #endif
\ No newline at end of file
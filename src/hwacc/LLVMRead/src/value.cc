@@ -3,6 +3,8 @@
 #include "llvm/IR/Instruction.h"
 #include "sim/sim_object.hh"
 
+const std::string SALAM::Value::noText;
+
 SALAM::Value::Value(uint64_t id, gem5::SimObject * _owner, bool _dbg) {
     uid = id;
     size = 0;
@@ -21,8 +23,7 @@ SALAM::Value::Value(const Value &copy_val)
     returnReg = copy_val.returnReg;
     valueTy = copy_val.valueTy;
     size = copy_val.size;
-    ir_string = copy_val.ir_string;
-    ir_stub = copy_val.ir_stub;
+    irText = copy_val.irText;
     owner = copy_val.owner;
     dbg = copy_val.dbg;
 }
@@ -33,8 +34,7 @@ SALAM::Value::Value(std::shared_ptr<SALAM::Value> copy_val)
     returnReg = copy_val->getReg();
     valueTy = copy_val->getType();
     size = copy_val->getSize();
-    ir_string = copy_val->getIRString();
-    ir_stub = copy_val->getIRStub();
+    irText = copy_val->irText;
     owner = copy_val->getOwner();
     dbg = copy_val->debug();
 }
@@ -47,8 +47,7 @@ SALAM::Value::operator = (Value &copy_val)
     returnReg = copy_val.returnReg;
     valueTy = copy_val.valueTy;
     size = copy_val.size;
-    ir_string = copy_val.ir_string;
-    ir_stub = copy_val.ir_stub;
+    irText = copy_val.irText;
     return *this;
 }
 
@@ -66,6 +65,10 @@ SALAM::Value::initialize(llvm::Value * irval, SALAM::irvmap * irmap) {
     llvm::Type *irtype = irval->getType();
     if (irtype->getTypeID() == llvm::Type::PointerTyID) {
         size = 64; //We assume a 64-bit memory address space
+    } else if (irtype->isVectorTy()) {
+        // Vectors span all of their lanes
+        llvm::Type *laneType = irtype->getScalarType();
+        size = vectorLanes(irtype) * (laneType->isPointerTy() ? 64 : laneType->getScalarSizeInBits());
     } else {
         size = irtype->getScalarSizeInBits();
     }
@@ -73,15 +76,34 @@ SALAM::Value::initialize(llvm::Value * irval, SALAM::irvmap * irmap) {
     // Link Return Register
     if (size>0) addRegister(irtype, true);
 
-    std::string tmpStr1;
-    llvm::raw_string_ostream ss(tmpStr1);
+    auto text = std::make_shared<ValueText>();
+    llvm::raw_string_ostream ss(text->ir_string);
     ss << *irval;
-    ir_string = ss.str();
+    ss.flush();
 
-    std::string tmpStr2;
-    llvm::raw_string_ostream ss2(tmpStr2);
+    llvm::raw_string_ostream ss2(text->ir_stub);
     irval->printAsOperand(ss2);
-    ir_stub = ss2.str();
+    ss2.flush();
+    irText = text;
+}
+
+void
+SALAM::Value::isolateRegister() {
+    // Copies share the register of the value they were made from. Replace it
+    // with a private register of the same type
+    if (!returnReg) return;
+    bool istracked = returnReg->isTracked();
+    if (returnReg->isPtr()) {
+        returnReg = std::make_shared<PointerRegister>(istracked);
+    } else if (returnReg->isInt()) {
+        returnReg = std::make_shared<APIntRegister>(size, istracked);
+    } else if (returnReg->isFP()) {
+        returnReg = std::make_shared<APFloatRegister>(valueTy, istracked);
+    } else if (returnReg->isVector()) {
+        auto vec = std::static_pointer_cast<VectorRegister>(returnReg);
+        returnReg = std::make_shared<VectorRegister>(vec->getLaneType(),
+            vec->getLanes(), vec->getLaneBytes(), istracked);
+    }
 }
 
 void
@@ -92,6 +114,8 @@ SALAM::Value::addRegister(llvm::Type *irtype, bool istracked) {
         returnReg = std::make_shared<APIntRegister>(irtype, istracked);
     } else if (irtype->isFloatingPointTy()) {
         returnReg = std::make_shared<APFloatRegister>(irtype, istracked);
+    } else if (irtype->isVectorTy()) {
+        returnReg = std::make_shared<VectorRegister>(irtype, istracked);
     } else {
         //assert(0); // Type is invalid for a register
         returnReg = nullptr;
@@ -200,8 +224,13 @@ SALAM::Value::setRegisterValue(const uint64_t data) {
     }
 }
 void
-SALAM::Value::setRegisterValue(uint8_t * data) {
+SALAM::Value::setRegisterValue(const uint8_t * data) {
     if (dbg) DPRINTFS(Runtime, owner, "| Set Register Data - ");
+    if (returnReg->isVector()) {
+        if (dbg) DPRINTFS(Runtime, owner, "Vector\n");
+        returnReg->writeVectorData(data, getSizeInBytes());
+        return;
+    }
     switch (valueTy) {
     #if USE_LLVM_AP_VALUES
         case llvm::Type::FloatTyID:
@@ -226,9 +255,9 @@ SALAM::Value::setRegisterValue(uint8_t * data) {
             if (size > 64) {
                 size_t bigIntLen = ((size - 1) / 64) + 1;
                 setRegisterValue(llvm::APInt(size,
-                    llvm::ArrayRef<uint64_t>((uint64_t *)data, bigIntLen)));
+                    llvm::ArrayRef<uint64_t>((const uint64_t *)data, bigIntLen)));
             } else {
-                setRegisterValue(llvm::APInt(size, *(uint64_t *)(data)));
+                setRegisterValue(llvm::APInt(size, *(const uint64_t *)(data)));
             }
             break;
         }
@@ -236,19 +265,19 @@ SALAM::Value::setRegisterValue(uint8_t * data) {
         case llvm::Type::FloatTyID:
         {
             if (dbg) DPRINTFS(Runtime, owner, "Float\n");
-            returnReg->writeFloatData(*(uint64_t *)data, (size_t)4);
+            returnReg->writeFloatData(*(const uint64_t *)data, (size_t)4);
             break;
         }
         case llvm::Type::DoubleTyID:
         {
             if (dbg) DPRINTFS(Runtime, owner, "Double\n");
-            returnReg->writeFloatData(*(uint64_t *)data, (size_t)8);
+            returnReg->writeFloatData(*(const uint64_t *)data, (size_t)8);
             break;
         }
         case llvm::Type::IntegerTyID:
         {
             if (dbg) DPRINTFS(Runtime, owner, "Integer Type | Size = %d\n", size);
-            returnReg->writeIntData(*(uint64_t *)data,
+            returnReg->writeIntData(*(const uint64_t *)data,
                                     (size_t)getSizeInBytes());
             break;
         }
@@ -256,7 +285,7 @@ SALAM::Value::setRegisterValue(uint8_t * data) {
         case llvm::Type::PointerTyID:
         {
             if (dbg) DPRINTFS(Runtime, owner, "Pointer\n");
-            returnReg->writePtrData(*(uint64_t *)data);
+            returnReg->writePtrData(*(const uint64_t *)data);
             break;
         }
         default:
@@ -292,7 +321,9 @@ SALAM::Value::setRegisterValue(bool data) {
 
 void
 SALAM::Value::setRegisterValue(std::shared_ptr<SALAM::Register> reg) {
-    if (reg->isPtr()) {
+    if (reg->isVector()) {
+        returnReg->writeVectorData(reg->getVectorData(), getSizeInBytes());
+    } else if (reg->isPtr()) {
         setRegisterValue((reg->getPtrData()));
     } else if (reg->isFP()) {
         setRegisterValue((reg->getFloatData()));
@@ -26,6 +26,13 @@ typedef std::pair<llvm::Value *, std::shared_ptr<Value>> irvmaptype;
 typedef std::map<llvm::Value *, std::shared_ptr<Value>> irvmap;
 typedef std::vector<std::shared_ptr<Value>> valueListTy;
 
+// Printable form of a static value. Set once when the value is initialized
+// and shared by every copy made of it
+struct ValueText {
+    std::string ir_string;
+    std::string ir_stub;
+};
+
 class Value
 {
     public:
@@ -34,8 +41,8 @@ class Value
         uint64_t uid = 0;
         uint64_t size = 0;
         gem5::SimObject * owner;
-        std::string ir_string;
-        std::string ir_stub;
+        std::shared_ptr<const ValueText> irText;
+        static const std::string noText;
         llvm::Type::TypeID valueTy;
         std::shared_ptr<SALAM::Register> returnReg;
         bool dbg = false;
@@ -87,9 +94,10 @@ class Value
         }
         uint64_t getUID() const { return uid; }
         std::shared_ptr<SALAM::Register> getReg() { return returnReg; }
+        void isolateRegister();
         llvm::Type::TypeID getType() { return valueTy; }
-        std::string getIRString() { return ir_string; }
-        std::string getIRStub() { return ir_stub; }
+        const std::string & getIRString() const { return irText ? irText->ir_string : noText; }
+        const std::string & getIRStub() const { return irText ? irText->ir_stub : noText; }
         gem5::SimObject * getOwner() { return owner; }
         bool debug() { return dbg; }
 
@@ -102,7 +110,7 @@ class Value
         void setRegisterValue(const llvm::APFloat &data);
     #endif
         void setRegisterValue(const uint64_t data);
-        void setRegisterValue(uint8_t * data);
+        void setRegisterValue(const uint8_t * data);
         void setRegisterValue(bool data);
         void setRegisterValue(std::shared_ptr<SALAM::Register> reg);
 
@@ -14,4 +14,11 @@ class ScratchpadMemory(AbstractMemory):
     read_on_invalid = Param.Bool(False, "Enable reads on invalid memory segments when ready mode is used")
     write_on_valid = Param.Bool(True, "Enable writes on valid memory sectors when ready mode is used")
     reset_on_scratchpad_read = Param.Bool(True, "Reset ready bit on private scratchpad memory read")
-    bandwidth = Param.MemoryBandwidth('12GB/s', "Combined read and write bandwidth per port")
\ No newline at end of file
+    ready_granularity = Param.UInt32(1, "Bytes covered by each ready bit when ready mode is used")
+    bandwidth = Param.MemoryBandwidth('12GB/s', "Combined read and write bandwidth per port")
+    num_banks = Param.UInt32(1, "Number of independently accessed SRAM banks")
+    interleaving = Param.String("cyclic", "Address to bank mapping: cyclic, block or mask")
+    bank_word_size = Param.UInt32(4, "Bytes mapped to one bank before moving to the next with cyclic interleaving")
+    bank_mask = Param.UInt64(0, "Address offset bits that form the bank index with mask interleaving")
+    bank_read_ports = Param.UInt32(0, "Read ports per bank, 0 = unlimited")
+    bank_write_ports = Param.UInt32(0, "Write ports per bank, 0 = unlimited")
@@ -0,0 +1,97 @@
+# Script extracts the LLVMInterface host timing breakdown from a simulation trace
+# and optionally compares it against a previously stored baseline
+import sys
+import os
+import re
+import csv
+from argparse import ArgumentParser
+
+parser = ArgumentParser()
+parser.add_argument("-f", "--file", dest="myFile", help="Opens specified simulation trace")
+parser.add_argument("-b", "--bench", dest="myBench", default="", help="Benchmark label stored with the results")
+parser.add_argument("-d", "--design", dest="myDesign", help="Appends results to specified csv file")
+parser.add_argument("-c", "--compare", dest="myBaseline", help="Compares results against specified baseline csv file")
+args = parser.parse_args()
+
+timers = {
+	"Setup Time": "setup",
+	"Simulation Time (Total)": "total",
+	"Simulation Time (Active)": "active",
+	"Queue Processing Time": "queue",
+	"Scheduling Time": "scheduling",
+	"Computation Time": "compute",
+}
+fields = ["bench", "accelerator", "cycles"] + list(timers.values())
+timeRegex = re.compile(r"(\d+)(h|ms|us|m|s)")
+scale = {"h": 3600.0, "m": 60.0, "s": 1.0, "ms": 1e-3, "us": 1e-6}
+
+def toSeconds(text):
+	seconds = 0.0
+	for value, unit in timeRegex.findall(text):
+		seconds += int(value) * scale[unit]
+	return seconds
+
+def parseTrace(fileName, bench):
+	results = []
+	current = None
+	lastLine = ""
+	name = ""
+	with open(fileName, "rt") as trace:
+		for line in trace:
+			line = line.rstrip()
+			if "========= Performance Analysis" in line:
+				current = {"bench": bench, "accelerator": name.strip()}
+				results.append(current)
+			elif current is not None:
+				key, sep, value = line.strip().partition(":")
+				if key in timers:
+					current[timers[key]] = toSeconds(value)
+				elif key == "Runtime" and "cycles" in value:
+					current["cycles"] = int(value.split()[0])
+			# printResults() emits the accelerator name right after a banner of asterisks
+			if lastLine.startswith("****") and not line.startswith("****"):
+				name = line
+			lastLine = line
+	return results
+
+def loadCsv(fileName):
+	with open(fileName, "rt") as results:
+		return list(csv.DictReader(results))
+
+def totals(rows):
+	summary = {}
+	for row in rows:
+		entry = summary.setdefault(row["bench"], dict.fromkeys(timers.values(), 0.0))
+		for timer in timers.values():
+			entry[timer] += float(row.get(timer, 0.0))
+	return summary
+
+rows = []
+if args.myFile:
+	rows = parseTrace(args.myFile, args.myBench)
+	for row in rows:
+		print("%-40s %12s cycles  queue %9.3fs  sched %9.3fs  active %9.3fs" % (
+			row["accelerator"], row.get("cycles", "-"), row.get("queue", 0.0),
+			row.get("scheduling", 0.0), row.get("active", 0.0)))
+	if args.myDesign:
+		newFile = not os.path.exists(args.myDesign)
+		with open(args.myDesign, "a") as designFile:
+			writer = csv.DictWriter(designFile, fieldnames=fields, restval=0)
+			if newFile:
+				writer.writeheader()
+			writer.writerows(rows)
+
+if args.myBaseline:
+	if not rows and args.myDesign:
+		rows = loadCsv(args.myDesign)
+	baseline = totals(loadCsv(args.myBaseline))
+	current = totals(rows)
+	for timer, label in (("queue", "queue processing"), ("scheduling", "scheduling")):
+		print("%-32s %12s %12s %9s" % ("Benchmark (%s)" % label, "baseline", "current", "speedup"))
+		for bench in sorted(current):
+			if bench not in baseline:
+				continue
+			old = baseline[bench][timer]
+			new = current[bench][timer]
+			speedup = (old / new) if new > 0 else float("inf")
+			print("%-32s %11.3fs %11.3fs %8.2fx" % (bench, old, new, speedup))
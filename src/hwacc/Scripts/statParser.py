@@ -1,15 +1,70 @@
 # Script opens the first pass of simulation 
+# With -c it instead reads a binary cycle trace written by HWStatistics
+# (cycle_tracking=True) and writes it as CSV with -o or prints a summary
 import sys
 import os
+import gzip
+import struct
 from argparse import ArgumentParser
 
+# Yields the field names of a cycle trace, then its records one at a time
+def readCycleTrace(traceFile):
+	with open(traceFile, "rb") as trace:
+		compressed = trace.read(2) == b"\x1f\x8b"
+	opener = gzip.open if compressed else open
+	with opener(traceFile, "rb") as trace:
+		if trace.read(8) != b"SALAMHWS":
+			sys.exit(traceFile + " is not a cycle trace")
+		version, count = struct.unpack("<II", trace.read(8))
+		if version != 1:
+			sys.exit("Unsupported cycle trace version " + str(version))
+		fields = []
+		for i in range(count):
+			length, = struct.unpack("<I", trace.read(4))
+			fields.append(trace.read(length).decode())
+		yield fields
+		record = struct.Struct("<" + str(count) + "i")
+		while True:
+			data = trace.read(record.size)
+			if len(data) < record.size:
+				break
+			yield record.unpack(data)
+
 parser = ArgumentParser()
 parser.add_argument("-f", "--file", dest="myFile", help="Opens specified file")
 parser.add_argument("-d", "--design", dest="myDesign", help="Saves to specified file")
+parser.add_argument("-c", "--cycles", dest="myCycles", help="Opens specified cycle trace")
+parser.add_argument("-o", "--output", dest="myOutput", help="Saves the cycle trace as CSV")
 args = parser.parse_args()
 myFile = args.myFile
 myDesign = args.myDesign
 
+if args.myCycles:
+	records = readCycleTrace(args.myCycles)
+	fields = next(records)
+	if args.myOutput:
+		with open(args.myOutput, "w") as csvFile:
+			csvFile.write(",".join(fields) + "\n")
+			for record in records:
+				csvFile.write(",".join(str(value) for value in record) + "\n")
+	else:
+		# Running sums and peaks, so the trace is never held in memory
+		cycles = 0
+		sums = [0] * len(fields)
+		peaks = [None] * len(fields)
+		for record in records:
+			cycles += 1
+			for i in range(1, len(fields)):
+				sums[i] += record[i]
+				if peaks[i] is None or record[i] > peaks[i]:
+					peaks[i] = record[i]
+		print ("Cycles: " + str(cycles))
+		for i, field in enumerate(fields[1:], 1):
+			mean = sums[i] / cycles if cycles else 0
+			peak = peaks[i] if cycles else 0
+			print ("{:<24} mean {:>10.3f} max {:>8}".format(field, mean, peak))
+	sys.exit(0)
+
 flag = False
 designFile = open(myDesign, "w")
 with open (myFile,"rt") as parameters:
@@ -17,7 +72,7 @@ with open (myFile,"rt") as parameters:
 		line = line.rstrip()
 		if not flag:
 			if line == r"StatsStart:":
-				print ('Adjusting Parameters')	
+				print ('Adjusting Parameters')
 				flag = True
 		else:
 			designFile.write(line)
@@ -4,6 +4,8 @@
 #include "mem/packet_access.hh"
 #include "sim/system.hh"
 
+#include <algorithm>
+#include <cstring>
 #include <stdio.h>
 #include <stdlib.h>
 #include <iomanip>
@@ -27,11 +29,16 @@ CommInterface::CommInterface(const CommInterfaceParams &p) :
     use_premap_data(p.premap_data),
     endian(p.system->getGuestByteOrder()),
     debugEnabled(p.enable_debug_msgs),
+    requestsInQueues(0),
+    coalesceRequests(p.coalesce_requests),
+    maxBurstSize(p.max_burst_size),
+    stats(*this),
     masterId(p.system->getRequestorId(this,name())),
     tickEvent(this),
     cacheLineSize(p.cache_line_size),
     clock_period(p.clock_period),
     reset_spm(p.reset_spm) {
+    if (maxBurstSize == 0) maxBurstSize = cacheLineSize;
     processDelay = 1000 * clock_period;
     FLAG_OFFSET = 0;
     CONFIG_OFFSET = flag_size;
@@ -46,6 +53,9 @@ CommInterface::CommInterface(const CommInterfaceParams &p) :
     }
     cu = nullptr;
 
+    readQueues.resize(NUM_PORT_TYPES);
+    writeQueues.resize(NUM_PORT_TYPES);
+
     if (use_premap_data) {
         for (auto i = 0; i < p.data_bases.size(); i++) {
             data_base_ptrs.push_back(p.data_bases[i]);
@@ -134,12 +144,18 @@ CommInterface::RegPort::sendPacket(PacketPtr pkt) {
 void
 CommInterface::recvPacket(PacketPtr pkt) {
 	if (pkt->isRead()) {
-        MemoryRequest * readReq = findMemRequest(pkt, true);
+        auto inflight = accRdQ.find(pkt);
+        if (inflight == accRdQ.end()) panic("Could not find memory request in request queues");
+        MemoryRequest * readReq = inflight->second.req;
+        PortType type = inflight->second.type;
         RequestPort * carrier = readReq->getCarrierPort();
-        if (MemSidePort * port = dynamic_cast<MemSidePort *>(carrier)) port->readReq = nullptr;
-        if (SPMPort * port = dynamic_cast<SPMPort *>(carrier)) port->readReq = nullptr;
+        if (type == SPM_PORT) static_cast<SPMPort *>(carrier)->readReq = nullptr;
+        else if (type == REG_PORT) static_cast<RegPort *>(carrier)->readReq = nullptr;
+        else static_cast<MemSidePort *>(carrier)->readReq = nullptr;
         if (debug()) DPRINTF(CommInterface, "Done with a read. addr: 0x%x, size: %d\n", pkt->req->getPaddr(), pkt->getSize());
-        pkt->writeData(readReq->buffer + (pkt->req->getPaddr() - readReq->beginAddr));
+        // Responses normally land in the request buffer already
+        uint8_t * readData = readReq->buffer + (pkt->req->getPaddr() - readReq->beginAddr);
+        if (pkt->getConstPtr<uint8_t>() != readData) pkt->writeData(readData);
         if (debug()) DPRINTF(CommInterface, "Read:%s\n", readReq->printBuffer());
         for (int i = pkt->req->getPaddr() - readReq->beginAddr;
              i < pkt->req->getPaddr() - readReq->beginAddr + pkt->getSize(); i++)\
@@ -156,31 +172,30 @@ CommInterface::recvPacket(PacketPtr pkt) {
         if (!readReq->needToRead)
         {
             if (debug()) DPRINTF(CommInterface, "Done reading \n");
-            cu->readCommit(readReq);
-            if (debug()) DPRINTF(CommInterface, "Clearing Request \n");
-            clearMemRequest(readReq, true);
-            delete readReq;
+            accRdQ.erase(inflight);
+            commitRead(readReq);
         } else {
-            readQueue.push_front(readReq);
-            clearMemRequest(readReq, true); // Clear the request from the in-flight queue
+            readQueues[type].push_front(readReq);
+            accRdQ.erase(inflight); // Clear the request from the in-flight queue
         }
     } else if (pkt->isWrite()) {
-        MemoryRequest * writeReq = findMemRequest(pkt, false);
+        auto inflight = accWrQ.find(pkt);
+        if (inflight == accWrQ.end()) panic("Could not find memory request in request queues");
+        MemoryRequest * writeReq = inflight->second.req;
+        PortType type = inflight->second.type;
         RequestPort * carrier = writeReq->getCarrierPort();
-        if (MemSidePort * port = dynamic_cast<MemSidePort *>(carrier)) port->writeReq = nullptr;
-        if (SPMPort * port = dynamic_cast<SPMPort *>(carrier)) port->writeReq = nullptr;
+        if (type == SPM_PORT) static_cast<SPMPort *>(carrier)->writeReq = nullptr;
+        else if (type == REG_PORT) static_cast<RegPort *>(carrier)->writeReq = nullptr;
+        else static_cast<MemSidePort *>(carrier)->writeReq = nullptr;
         if (debug()) DPRINTF(CommInterface, "Done with a write. addr: 0x%x, size: %d\n", pkt->req->getPaddr(), pkt->getSize());
         writeReq->writeDone += pkt->getSize();
         if (!(writeReq->needToWrite)) {
             if (debug()) DPRINTF(CommInterface, "Done writing\n");
-            cu->writeCommit(writeReq);
-            // delete[] writeReq->buffer;
-            // delete[] writeReq->readsDone;
-            clearMemRequest(writeReq, false);
-            delete writeReq;
+            accWrQ.erase(inflight);
+            commitWrite(writeReq);
         } else {
-            writeQueue.push_front(writeReq);
-            clearMemRequest(writeReq, false); // Clear the request from the in-flight queue
+            writeQueues[type].push_front(writeReq);
+            accWrQ.erase(inflight); // Clear the request from the in-flight queue
         }
     } else {
         panic("Something went very wrong!");
@@ -194,6 +209,111 @@ CommInterface::recvPacket(PacketPtr pkt) {
     delete pkt;
 }
 
+void
+CommInterface::commitRead(MemoryRequest * req) {
+    if (req->coalesced.empty()) {
+        cu->readCommit(req);
+    } else {
+        // Hand each merged request its slice of the burst
+        for (auto child : req->coalesced) {
+            std::memcpy(child->buffer, req->buffer + (child->address - req->address), child->length);
+            child->readDone = child->totalLength;
+            child->readLeft = 0;
+            child->needToRead = false;
+            cu->readCommit(child);
+            delete child;
+        }
+    }
+    if (debug()) DPRINTF(CommInterface, "Clearing Request \n");
+    delete req;
+}
+
+void
+CommInterface::commitWrite(MemoryRequest * req) {
+    if (req->coalesced.empty()) {
+        cu->writeCommit(req);
+    } else {
+        for (auto child : req->coalesced) {
+            child->writeDone = child->totalLength;
+            child->writeLeft = 0;
+            child->needToWrite = false;
+            cu->writeCommit(child);
+            delete child;
+        }
+    }
+    delete req;
+}
+
+void
+CommInterface::coalesce(std::vector<MemoryRequest*> &pending, bool read) {
+    auto &queues = read ? readQueues : writeQueues;
+    std::stable_sort(pending.begin(), pending.end(),
+        [](MemoryRequest * a, MemoryRequest * b) { return a->address < b->address; });
+    for (auto it = pending.begin(); it != pending.end(); ) {
+        Addr start = (*it)->address;
+        Addr end = start + (*it)->length;
+        PortType type = classifyAddress(start);
+        auto range = portRangeIndex.contains(start);
+        auto last = it + 1;
+        // Only plain memory ports take bursts. Streams are order dependent and
+        // scratchpads may gate accesses on the ready state of each byte.
+        // Atomics always travel alone
+        if ((type == LOCAL_PORT || type == GLOBAL_PORT) && range != portRangeIndex.end() &&
+            !(*it)->isAtomic()) {
+            while (last != pending.end() && !(*last)->isAtomic()) {
+                Addr next = (*last)->address;
+                Addr nextEnd = next + (*last)->length;
+                // Reads may overlap, writes have to be exactly adjacent
+                if ((read ? next > end : next != end) ||
+                    std::max(end, nextEnd) - start > maxBurstSize ||
+                    !range->first.contains(nextEnd - 1)) break;
+                end = std::max(end, nextEnd);
+                ++last;
+            }
+        }
+        MemoryRequest * burst;
+        if (last - it == 1) {
+            burst = *it;
+        } else if (read) {
+            burst = new MemoryRequest(start, end - start);
+            burst->coalesced.assign(it, last);
+        } else {
+            std::vector<uint8_t> data(end - start);
+            for (auto child = it; child != last; ++child)
+                std::memcpy(&data[(*child)->address - start], (*child)->buffer, (*child)->length);
+            burst = new MemoryRequest(start, data.data(), end - start);
+            burst->coalesced.assign(it, last);
+        }
+        if (debug() && burst != *it)
+            DPRINTF(CommInterface, "Coalesced %d %s requests into a %d byte burst at 0x%lx\n",
+                    burst->coalesced.size(), read ? "read" : "write", end - start, start);
+        queues[type].push_back(burst);
+        stats.memBursts++;
+        it = last;
+    }
+    pending.clear();
+}
+
+RequestPtr
+CommInterface::atomicRequest(MemoryRequest * readReq, int size) {
+    // Atomics are never split, the whole access goes out as one swap packet
+    panic_if(size != readReq->length, "Atomic access of %d bytes at 0x%lx crosses a cache line\n",
+             readReq->length, readReq->address);
+    Request::Flags flags;
+    AtomicOpFunctorPtr amo;
+    if (readReq->atomicOp) {
+        flags.set(Request::ATOMIC_RETURN_OP);
+        amo.reset(readReq->atomicOp->clone());
+    } else {
+        flags.set(Request::MEM_SWAP_COND);
+    }
+    RequestPtr req = make_shared<Request>(readReq->address, size, flags, masterId, 0, 0, std::move(amo));
+    req->setPaddr(readReq->address);
+    if (readReq->condSwap) req->setExtraData(readReq->compareValue);
+    stats.atomicRequests++;
+    return req;
+}
+
 void
 CommInterface::checkMMR() {
     if (!computationNeeded) {
@@ -213,69 +333,62 @@ CommInterface::checkMMR() {
     }
 }
 
-bool
-CommInterface::inStreamRange(Addr add) {
-    for (auto port : streamPorts) {
-        AddrRangeList adl = port->getAddrRanges();
-        for (auto address : adl) {
-            if (address.contains(add)) {
-                return true;
-            }
+void
+CommInterface::indexPortRanges() {
+    // Insert in decode priority so the first range claiming an address wins
+    auto indexRanges = [this](RequestPort * port, PortType type) {
+        for (auto range : port->getAddrRanges()) {
+            if (portRangeIndex.insert(range, type) == portRangeIndex.end())
+                overlappingRanges.push_back({range, type});
         }
-    }
-    return false;
+    };
+    for (auto port : regPorts) indexRanges(port, REG_PORT);
+    for (auto port : streamPorts) indexRanges(port, STREAM_PORT);
+    for (auto port : spmPorts) indexRanges(port, SPM_PORT);
+    for (auto port : localPorts) indexRanges(port, LOCAL_PORT);
+    for (auto port : globalPorts) indexRanges(port, GLOBAL_PORT);
+    portRangesIndexed = true;
 }
 
-bool
-CommInterface::inSPMRange(Addr add) {
-    for (auto port : spmPorts) {
-        AddrRangeList adl = port->getAddrRanges();
-        for (auto address : adl) {
-            if (address.contains(add)) {
-                return true;
-            }
-        }
+CommInterface::PortType
+CommInterface::classifyAddress(Addr add) {
+    if (!portRangesIndexed) indexPortRanges();
+    auto it = portRangeIndex.contains(add);
+    if (it != portRangeIndex.end()) return it->second;
+    for (auto &range : overlappingRanges) {
+        if (range.first.contains(add)) return range.second;
     }
-    return false;
+    return NUM_PORT_TYPES;
 }
 
-bool
-CommInterface::inRegRange(Addr add) {
-    for (auto port : regPorts) {
-        AddrRangeList adl = port->getAddrRanges();
-        for (auto address : adl) {
-            if (address.contains(add)) {
-                return true;
-            }
+size_t
+CommInterface::freePorts(PortType type, bool read) {
+    size_t count = 0;
+    if (type == SPM_PORT) {
+        for (auto port : spmPorts) {
+            if (!(port->isStalled()) && ((read && !(port->readReq)) || (!read && !(port->writeReq))))
+                count++;
         }
-    }
-    return false;
-}
-
-bool
-CommInterface::inLocalRange(Addr add) {
-    for (auto port : localPorts) {
-        AddrRangeList adl = port->getAddrRanges();
-        for (auto address : adl) {
-            if (address.contains(add)) {
-                return true;
-            }
+    } else {
+        auto &ports = (type == STREAM_PORT) ? streamPorts :
+                      (type == LOCAL_PORT) ? localPorts : globalPorts;
+        for (auto port : ports) {
+            if (!(port->isStalled()) && ((read && !(port->readReq)) || (!read && !(port->writeReq))))
+                count++;
         }
     }
-    return false;
+    return count;
 }
 
-bool
-CommInterface::inGlobalRange(Addr add) {
-    for (auto port : globalPorts) {
-        AddrRangeList adl = port->getAddrRanges();
-        for (auto address : adl) {
-            if (address.contains(add)) {
-                return true;
-            }
-        }
+RequestPort *
+CommInterface::getValidPort(PortType type, Addr add, size_t len, bool read) {
+    switch (type) {
+        case STREAM_PORT: return getValidStreamPort(add, len, read);
+        case SPM_PORT: return getValidSPMPort(add, len, read);
+        case LOCAL_PORT: return getValidLocalPort(add, read);
+        case GLOBAL_PORT: return getValidGlobalPort(add, read);
+        default: return nullptr;
     }
-    return false;
 }
 
 CommInterface::MemSidePort *
@@ -352,103 +465,159 @@ CommInterface::getValidRegPort(Addr add) {
     return nullptr;
 }
 
+RequestPort *
+CommInterface::getFunctionalPort(PortType type, Addr add) {
+    // Functional accesses never wait, any port reaching the address will do
+    auto find = [add](auto &ports) -> RequestPort * {
+        for (auto port : ports) {
+            for (auto address : port->getAddrRanges()) {
+                if (address.contains(add)) return port;
+            }
+        }
+        return nullptr;
+    };
+    switch (type) {
+        case REG_PORT: return find(regPorts);
+        case SPM_PORT: return find(spmPorts);
+        case LOCAL_PORT: return find(localPorts);
+        case GLOBAL_PORT: return find(globalPorts);
+        case STREAM_PORT:
+            fatal("Stream access at 0x%lx cannot be executed functionally\n", add);
+        default: return nullptr;
+    }
+}
+
+void
+CommInterface::functionalAccess(Addr add, uint8_t * data, size_t len, bool read) {
+    PortType type = classifyAddress(add);
+    RequestPort * port = getFunctionalPort(type, add);
+    if (!port) panic("Address %lx is not reachable by any ports\n", add);
+    if (debug()) DPRINTF(CommInterface, "Functional %s of %d bytes at 0x%lx through port: %s\n",
+        read ? "read" : "write", len, add, port->name());
+    stats.functionalBytes += len;
+    // Split on cache lines like the timing path so caches see whole blocks
+    while (len > 0) {
+        size_t size = std::min<size_t>(len, cacheLineSize - (add % cacheLineSize));
+        RequestPtr req = make_shared<Request>(add, size, Request::Flags(), masterId);
+        Packet pkt(req, read ? MemCmd::ReadReq : MemCmd::WriteReq);
+        pkt.dataStatic(data);
+        port->sendFunctional(&pkt);
+        add += size;
+        data += size;
+        len -= size;
+    }
+}
+
+void
+CommInterface::functionalRead(MemoryRequest * req) {
+    stats.functionalRequests++;
+    if (!req->isAtomic()) {
+        functionalAccess(req->address, req->buffer, req->length, true);
+        return;
+    }
+    // Functional packets carry no atomic operation. The update is applied
+    // here between a read and a write of the location, and the buffer
+    // returns the old value as a swap response would
+    std::vector<uint8_t> current(req->length);
+    functionalAccess(req->address, current.data(), req->length, true);
+    std::vector<uint8_t> updated(current);
+    bool store = true;
+    if (req->atomicOp) {
+        (*req->atomicOp)(updated.data());
+    } else {
+        uint64_t value = 0;
+        std::memcpy(&value, current.data(), std::min(req->length, sizeof(value)));
+        store = (value == req->compareValue);
+        std::memcpy(updated.data(), req->buffer, req->length);
+    }
+    if (store) functionalAccess(req->address, updated.data(), req->length, false);
+    std::memcpy(req->buffer, current.data(), req->length);
+}
+
+void
+CommInterface::functionalWrite(MemoryRequest * req) {
+    stats.functionalRequests++;
+    functionalAccess(req->address, req->buffer, req->length, false);
+}
+
 void
 CommInterface::processMemoryRequests() {
     if (!allPortsStalled()) {
-        if (debug()) DPRINTF(CommInterface, "Checking read requests. %d requests in queue.\n", readQueue.size());
-        for (auto it=readQueue.begin(); it!=readQueue.end(); ) {
-            Addr address = (*it)->currentReadAddr;
-            if (debug()) DPRINTF(CommInterfaceQueues, "Request Address: %lx\n", address);
-            RequestPort * mport;
-            if (inStreamRange(address)) {
-                mport = getValidStreamPort(address, (*it)->readLeft, true);
-            } else if (inSPMRange(address)) {
-                mport = getValidSPMPort(address, (*it)->readLeft, true);
-            } else if (inLocalRange(address)) {
-                mport = getValidLocalPort(address, true);
-            } else if (inGlobalRange(address)) {
-                mport = getValidGlobalPort(address, true);
-            } else {
-                panic("Address %lx is not reachable by any ports\n", address);
-            }
-            if (SPMPort * port = dynamic_cast<SPMPort *>(mport)) {
-                if (debug()) DPRINTF(CommInterfaceQueues, "Found available memory port\n");
-                port->readReq = (*it);
-                port->readReq->setCarrierPort(port);
-                it = readQueue.erase(it);
-                if (port->readReq && port->readReq->needToRead) {
-                    if (debug()) DPRINTF(CommInterfaceQueues, "Trying read on available memory port\n");
-                    tryRead(port);
-                    accRdQ.push_back(port->readReq);
-                    // if (!port->readReq->needToRead)
-                    //     port->readReq = NULL;
+        if (debug()) DPRINTF(CommInterface, "Checking read requests. %d requests in queue.\n", queuedRequests(readQueues));
+        for (int type = STREAM_PORT; type < NUM_PORT_TYPES; type++) {
+            auto &readQueue = readQueues[type];
+            // Only walk as far as there are ports left to take requests
+            size_t available = readQueue.empty() ? 0 : freePorts((PortType)type, true);
+            for (auto it=readQueue.begin(); it!=readQueue.end() && available > 0; ) {
+                Addr address = (*it)->currentReadAddr;
+                if (debug()) DPRINTF(CommInterfaceQueues, "Request Address: %lx\n", address);
+                RequestPort * mport = getValidPort((PortType)type, address, (*it)->readLeft, true);
+                if (mport == nullptr) {
+                    if (debug()) DPRINTF(CommInterfaceQueues, "Found no ports able to read %d bytes from %lx\n", (*it)->length, address);
+                    ++it;
+                    continue;
                 }
-            } else if (MemSidePort * port = dynamic_cast<MemSidePort *>(mport)) {
                 if (debug()) DPRINTF(CommInterfaceQueues, "Found available memory port\n");
-                port->readReq = (*it);
-                port->readReq->setCarrierPort(port);
+                MemoryRequest * readReq = (*it);
+                readReq->setCarrierPort(mport);
                 it = readQueue.erase(it);
-                if (port->readReq && port->readReq->needToRead) {
-                    if (debug()) DPRINTF(CommInterfaceQueues, "Trying read on available memory port\n");
-                    tryRead(port);
-                    accRdQ.push_back(port->readReq);
-                    // if (!port->readReq->needToRead)
-                    //     port->readReq = NULL;
+                available--;
+                if (type == SPM_PORT) {
+                    SPMPort * port = static_cast<SPMPort *>(mport);
+                    port->readReq = readReq;
+                    if (readReq->needToRead) {
+                        if (debug()) DPRINTF(CommInterfaceQueues, "Trying read on available memory port\n");
+                        tryRead(port);
+                    }
+                } else {
+                    MemSidePort * port = static_cast<MemSidePort *>(mport);
+                    port->readReq = readReq;
+                    if (readReq->needToRead) {
+                        if (debug()) DPRINTF(CommInterfaceQueues, "Trying read on available memory port\n");
+                        tryRead(port);
+                    }
                 }
-            } else {
-                if (debug()) DPRINTF(CommInterfaceQueues, "Found no ports able to read %d bytes from %lx\n", (*it)->length, address);
-                ++it;
             }
         }
-        if (debug()) DPRINTF(CommInterface, "Checking write requests. %d requests in queue.\n", writeQueue.size());
-        for (auto it=writeQueue.begin(); it!=writeQueue.end(); ) {
-            Addr address = (*it)->currentWriteAddr;
-            if (debug()) DPRINTF(CommInterfaceQueues, "Request Address: %lx\n", address);
-            RequestPort * mport;
-            if (inStreamRange(address)) {
-                mport = getValidStreamPort(address, (*it)->writeLeft, false);
-            } else if (inSPMRange(address)) {
-                mport = getValidSPMPort(address, (*it)->writeLeft, false);
-            } else if (inLocalRange(address)) {
-                mport = getValidLocalPort(address, false);
-            } else if (inGlobalRange(address)) {
-                mport = getValidGlobalPort(address, false);
-            } else {
-                panic("Address %lx is not reachable by any ports\n", address);
-            }
-            if (SPMPort * port = dynamic_cast<SPMPort*>(mport)) {
-                if (debug()) DPRINTF(CommInterfaceQueues, "Found available memory port\n");
-                port->writeReq = (*it);
-                port->writeReq->setCarrierPort(port);
-                it = writeQueue.erase(it);
-                if (port->writeReq && port->writeReq->needToWrite) {
-                    if (debug()) DPRINTF(CommInterfaceQueues, "Trying write on available memory port\n");
-                    tryWrite(port);
-                    accWrQ.push_back(port->writeReq);
-                    // if (!port->writeReq->needToWrite)
-                    //     port->writeReq = NULL;
+        if (debug()) DPRINTF(CommInterface, "Checking write requests. %d requests in queue.\n", queuedRequests(writeQueues));
+        for (int type = STREAM_PORT; type < NUM_PORT_TYPES; type++) {
+            auto &writeQueue = writeQueues[type];
+            size_t available = writeQueue.empty() ? 0 : freePorts((PortType)type, false);
+            for (auto it=writeQueue.begin(); it!=writeQueue.end() && available > 0; ) {
+                Addr address = (*it)->currentWriteAddr;
+                if (debug()) DPRINTF(CommInterfaceQueues, "Request Address: %lx\n", address);
+                RequestPort * mport = getValidPort((PortType)type, address, (*it)->writeLeft, false);
+                if (mport == nullptr) {
+                    if (debug()) DPRINTF(CommInterfaceQueues, "Found no ports able to write %d bytes to %lx\n", (*it)->length, address);
+                    ++it;
+                    continue;
                 }
-            } else if (MemSidePort * port = dynamic_cast<MemSidePort*>(mport)) {
                 if (debug()) DPRINTF(CommInterfaceQueues, "Found available memory port\n");
-                port->writeReq = (*it);
-                port->writeReq->setCarrierPort(port);
+                MemoryRequest * writeReq = (*it);
+                writeReq->setCarrierPort(mport);
                 it = writeQueue.erase(it);
-                if (port->writeReq && port->writeReq->needToWrite) {
-                    if (debug()) DPRINTF(CommInterfaceQueues, "Trying write on available memory port\n");
-                    tryWrite(port);
-                    accWrQ.push_back(port->writeReq);
-                    // if (!port->writeReq->needToWrite)
-                    //     port->writeReq = NULL;
+                available--;
+                if (type == SPM_PORT) {
+                    SPMPort * port = static_cast<SPMPort *>(mport);
+                    port->writeReq = writeReq;
+                    if (writeReq->needToWrite) {
+                        if (debug()) DPRINTF(CommInterfaceQueues, "Trying write on available memory port\n");
+                        tryWrite(port);
+                    }
+                } else {
+                    MemSidePort * port = static_cast<MemSidePort *>(mport);
+                    port->writeReq = writeReq;
+                    if (writeReq->needToWrite) {
+                        if (debug()) DPRINTF(CommInterfaceQueues, "Trying write on available memory port\n");
+                        tryWrite(port);
+                    }
                 }
-            } else {
-                if (debug()) DPRINTF(CommInterfaceQueues, "Found no ports able to write %d bytes to %lx\n", (*it)->length, address);
-                ++it;
             }
         }
     } else {
         if (debug()) DPRINTF(CommInterface, "All ports are stalled\n");
     }
-    requestsInQueues = readQueue.size() + writeQueue.size();
+    requestsInQueues = queuedRequests(readQueues) + queuedRequests(writeQueues);
     if (!tickEvent.scheduled() && requestsInQueues>0) {
         schedule(tickEvent, curTick() + processDelay);
         //schedule(tickEvent, nextCycle());
@@ -459,7 +628,9 @@ void
 CommInterface::tick() {
     if (debug()) DPRINTF(CommInterface, "Tick!\n");
     checkMMR();
-    requestsInQueues = readQueue.size() + writeQueue.size();
+    if (!pendingReads.empty()) coalesce(pendingReads, true);
+    if (!pendingWrites.empty()) coalesce(pendingWrites, false);
+    requestsInQueues = queuedRequests(readQueues) + queuedRequests(writeQueues);
     if (requestsInQueues > 0)
         processMemoryRequests();
 }
@@ -468,6 +639,8 @@ void
 CommInterface::tryRead(MemSidePort * port) {
     MemoryRequest * readReq = port->readReq;
     Request::Flags flags;
+    panic_if(readReq->isAtomic() && port->portType == STREAM_PORT,
+             "Atomic access to stream address 0x%lx\n", readReq->address);
     if (readReq->readLeft <= 0) {
         if (debug()) DPRINTF(CommInterface, "Something went wrong. Shouldn't try to read if there aren't reads left\n");
         return;
@@ -480,13 +653,15 @@ CommInterface::tryRead(MemSidePort * port) {
         size = cacheLineSize;
     }
     size = readReq->readLeft > (size - 1) ? size : readReq->readLeft;
-    RequestPtr req = make_shared<Request>(readReq->currentReadAddr, size, flags, masterId);
+    RequestPtr req = readReq->isAtomic() ? atomicRequest(readReq, size) :
+        make_shared<Request>(readReq->currentReadAddr, size, flags, masterId);
     if (debug()) DPRINTF(CommInterface, "Trying to read addr: 0x%016x, %d bytes through port: %s\n",
         req->getPaddr(), size, port->name());
 
-    PacketPtr pkt = new Packet(req, MemCmd::ReadReq);
-    pkt->allocate();
+    PacketPtr pkt = new Packet(req, readReq->isAtomic() ? MemCmd::SwapReq : MemCmd::ReadReq);
+    pkt->dataStatic(readReq->buffer + (readReq->currentReadAddr - readReq->beginAddr));
     readReq->pkt = pkt;
+    trackMemRequest(pkt, readReq, port->portType, true);
     port->sendPacket(pkt);
 
     readReq->currentReadAddr += size;
@@ -526,10 +701,7 @@ CommInterface::tryWrite(MemSidePort * port) {
     size = writeReq->writeLeft > size - 1 ? size : writeReq->writeLeft;
 
     Request::Flags flags;
-    uint8_t *data = new uint8_t[size];
-    std::memcpy(data, &(writeReq->buffer[writeReq->totalLength-writeReq->writeLeft]), size);
     RequestPtr req = make_shared<Request>(writeReq->currentWriteAddr, size, flags, masterId);
-    req->setExtraData((uint64_t)data);
 
 
     if (debug()) DPRINTF(CommInterface, "totalLength: %d, writeLeft: %d\n", writeReq->totalLength, writeReq->writeLeft);
@@ -539,9 +711,10 @@ CommInterface::tryWrite(MemSidePort * port) {
         port->name());
 
     PacketPtr pkt = new Packet(req, MemCmd::WriteReq);
-    uint8_t *pkt_data = (uint8_t *)req->getExtraData();
-    pkt->dataDynamic(pkt_data);
+    // The request outlives its packets, so the payload is handed over in place
+    pkt->dataStatic(&(writeReq->buffer[writeReq->totalLength-writeReq->writeLeft]));
     writeReq->pkt = pkt;
+    trackMemRequest(pkt, writeReq, port->portType, false);
     port->sendPacket(pkt);
 
     writeReq->currentWriteAddr += size;
@@ -575,13 +748,15 @@ CommInterface::tryRead(SPMPort * port) {
         size = cacheLineSize;
     }
     size = readReq->readLeft > (size - 1) ? size : readReq->readLeft;
-    RequestPtr req = make_shared<Request>(readReq->currentReadAddr, size, flags, masterId);
+    RequestPtr req = readReq->isAtomic() ? atomicRequest(readReq, size) :
+        make_shared<Request>(readReq->currentReadAddr, size, flags, masterId);
     if (debug()) DPRINTF(CommInterface, "Trying to read addr: 0x%016x, %d bytes through port: %s\n",
         req->getPaddr(), size, port->name());
 
-    PacketPtr pkt = new Packet(req, MemCmd::ReadReq);
-    pkt->allocate();
+    PacketPtr pkt = new Packet(req, readReq->isAtomic() ? MemCmd::SwapReq : MemCmd::ReadReq);
+    pkt->dataStatic(readReq->buffer + (readReq->currentReadAddr - readReq->beginAddr));
     readReq->pkt = pkt;
+    trackMemRequest(pkt, readReq, SPM_PORT, true);
     port->sendPacket(pkt);
 
     readReq->currentReadAddr += size;
@@ -621,10 +796,7 @@ CommInterface::tryWrite(SPMPort * port) {
     size = writeReq->writeLeft > size - 1 ? size : writeReq->writeLeft;
 
     Request::Flags flags;
-    uint8_t *data = new uint8_t[size];
-    std::memcpy(data, &(writeReq->buffer[writeReq->totalLength-writeReq->writeLeft]), size);
     RequestPtr req = make_shared<Request>(writeReq->currentWriteAddr, size, flags, masterId);
-    req->setExtraData((uint64_t)data);
 
 
     if (debug()) DPRINTF(CommInterface, "totalLength: %d, writeLeft: %d\n", writeReq->totalLength, writeReq->writeLeft);
@@ -634,9 +806,10 @@ CommInterface::tryWrite(SPMPort * port) {
         port->name());
 
     PacketPtr pkt = new Packet(req, MemCmd::WriteReq);
-    uint8_t *pkt_data = (uint8_t *)req->getExtraData();
-    pkt->dataDynamic(pkt_data);
+    // The request outlives its packets, so the payload is handed over in place
+    pkt->dataStatic(&(writeReq->buffer[writeReq->totalLength-writeReq->writeLeft]));
     writeReq->pkt = pkt;
+    trackMemRequest(pkt, writeReq, SPM_PORT, false);
     port->sendPacket(pkt);
 
     writeReq->currentWriteAddr += size;
@@ -658,6 +831,7 @@ void
 CommInterface::tryRead(RegPort * port) {
     MemoryRequest * readReq = port->readReq;
     Request::Flags flags;
+    panic_if(readReq->isAtomic(), "Atomic access to register bank address 0x%lx\n", readReq->address);
     if (readReq->readLeft <= 0) {
         if (debug()) DPRINTF(CommInterface, "Something went wrong. Shouldn't try to read if there aren't reads left\n");
         return;
@@ -668,8 +842,9 @@ CommInterface::tryRead(RegPort * port) {
         req->getPaddr(), size, port->name());
 
     PacketPtr pkt = new Packet(req, MemCmd::ReadReq);
-    pkt->allocate();
+    pkt->dataStatic(readReq->buffer + (readReq->currentReadAddr - readReq->beginAddr));
     readReq->pkt = pkt;
+    trackMemRequest(pkt, readReq, REG_PORT, true);
     readReq->currentReadAddr += size;
     readReq->readLeft -= size;
     if (readReq->readLeft <= 0) readReq->needToRead = false;
@@ -693,10 +868,7 @@ CommInterface::tryWrite(RegPort * port) {
     int size = writeReq->writeLeft;
 
     Request::Flags flags;
-    uint8_t *data = new uint8_t[size];
-    std::memcpy(data, &(writeReq->buffer[writeReq->totalLength-writeReq->writeLeft]), size);
     RequestPtr req = make_shared<Request>(writeReq->currentWriteAddr, size, flags, masterId);
-    req->setExtraData((uint64_t)data);
 
 
     if (debug()) DPRINTF(CommInterface, "totalLength: %d, writeLeft: %d\n", writeReq->totalLength, writeReq->writeLeft);
@@ -706,9 +878,10 @@ CommInterface::tryWrite(RegPort * port) {
         port->name());
 
     PacketPtr pkt = new Packet(req, MemCmd::WriteReq);
-    uint8_t *pkt_data = (uint8_t *)req->getExtraData();
-    pkt->dataDynamic(pkt_data);
+    // The request outlives its packets, so the payload is handed over in place
+    pkt->dataStatic(&(writeReq->buffer[writeReq->totalLength-writeReq->writeLeft]));
     writeReq->pkt = pkt;
+    trackMemRequest(pkt, writeReq, REG_PORT, false);
     writeReq->currentWriteAddr += size;
     writeReq->writeLeft -= size;
     if (writeReq->writeLeft <= 0) writeReq->needToWrite = false;
@@ -723,20 +896,29 @@ CommInterface::tryWrite(RegPort * port) {
 
 void
 CommInterface::enqueueRead(MemoryRequest * req) {
-    if (inRegRange(req->getAddress())) {
+    PortType type = classifyAddress(req->getAddress());
+    if (type == REG_PORT) {
         // We want to immediately handle register requests
         // and bypass memory queues
         auto regport = getValidRegPort(req->getAddress());
-        accRdQ.push_back(req); // Add it to active read queue
         regport->setReadReq(req);
         req->setCarrierPort(regport);
         tryRead(regport);
+    } else if (type == NUM_PORT_TYPES) {
+        panic("Address %lx is not reachable by any ports\n", req->getAddress());
     } else {
         if (debug()) DPRINTF(CommInterface, "Read from 0x%lx of Size:%d Bytes Enqueued:\n", req->address, req->length);
-        readQueue.push_back(req);
+        stats.memRequests++;
+        if (coalesceRequests) {
+            // Held back until the next tick so neighbouring requests can merge
+            pendingReads.push_back(req);
+        } else {
+            readQueues[type].push_back(req);
+            stats.memBursts++;
+        }
         if (debug()) {
             DPRINTF(CommInterfaceQueues, "Current Queue:\n");
-            for (auto it=readQueue.begin(); it!=readQueue.end(); ++it) {
+            for (auto it=readQueues[type].begin(); it!=readQueues[type].end(); ++it) {
                 DPRINTF(CommInterfaceQueues, "Read Request: %lx\n", (*it)->address);
             }
         }
@@ -748,20 +930,29 @@ CommInterface::enqueueRead(MemoryRequest * req) {
 
 void
 CommInterface::enqueueWrite(MemoryRequest * req) {
-    if (inRegRange(req->getAddress())) {
+    PortType type = classifyAddress(req->getAddress());
+    if (type == REG_PORT) {
         // We want to immediately handle register requests
         // and bypass memory queues
         auto regport = getValidRegPort(req->getAddress());
-        accWrQ.push_back(req); // Add it to active write queue
         regport->setWriteReq(req);
         req->setCarrierPort(regport);
         tryWrite(regport);
+    } else if (type == NUM_PORT_TYPES) {
+        panic("Address %lx is not reachable by any ports\n", req->getAddress());
     } else {
         if (debug()) DPRINTF(CommInterface, "Write to 0x%lx of size:%d bytes enqueued\n", req->address, req->length);
-        writeQueue.push_back(req);
+        stats.memRequests++;
+        if (coalesceRequests) {
+            // Held back until the next tick so neighbouring requests can merge
+            pendingWrites.push_back(req);
+        } else {
+            writeQueues[type].push_back(req);
+            stats.memBursts++;
+        }
         if (debug()) {
             DPRINTF(CommInterfaceQueues, "Current Queue:\n");
-            for (auto it=writeQueue.begin(); it!=writeQueue.end(); ++it) {
+            for (auto it=writeQueues[type].begin(); it!=writeQueues[type].end(); ++it) {
                 DPRINTF(CommInterfaceQueues, "Write Request: %lx\n", (*it)->address);
             }
         }
@@ -778,6 +969,8 @@ CommInterface::finish() {
     computationNeeded = false;
     if (int_num>0) {
         int_flag = true;
+        // The GIC may live on another event queue when accelerators run in parallel
+        EventQueue::ScopedMigration migrate(gic->eventQueue());
         gic->sendInt(int_num);
     }
     if (reset_spm) {
@@ -849,8 +1042,10 @@ CommInterface::write(PacketPtr pkt) {
     pkt->makeAtomicResponse();
 
     if (((*mmreg & 0x04) == 0x00) && int_flag) {
-        if (int_num > 0)
+        if (int_num > 0) {
+            EventQueue::ScopedMigration migrate(gic->eventQueue());
             gic->clearInt(int_num);
+        }
         int_flag = false;
     }
     if (!tickEvent.scheduled()) {
@@ -894,7 +1089,7 @@ CommInterface::getPort(const std::string& if_name, PortID idx) {
         }
         if (localPorts[idx] == nullptr) {
             const std::string portName = name() + ".local[" + std::to_string(idx) + "]";
-            localPorts[idx] = new MemSidePort(portName, this, idx);
+            localPorts[idx] = new MemSidePort(portName, this, LOCAL_PORT, idx);
         }
         return *localPorts[idx];
     } else if (if_name == "acp") {
@@ -903,7 +1098,7 @@ CommInterface::getPort(const std::string& if_name, PortID idx) {
         }
         if (globalPorts[idx] == nullptr) {
             const std::string portName = name() + ".acp[" + std::to_string(idx) + "]";
-            globalPorts[idx] = new MemSidePort(portName, this, idx);
+            globalPorts[idx] = new MemSidePort(portName, this, GLOBAL_PORT, idx);
         }
         return *globalPorts[idx];
     } else if (if_name == "stream") {
@@ -912,7 +1107,7 @@ CommInterface::getPort(const std::string& if_name, PortID idx) {
         }
         if (streamPorts[idx] == nullptr) {
             const std::string portName = name() + ".stream[" + std::to_string(idx) + "]";
-            streamPorts[idx] = new MemSidePort(portName, this, idx);
+            streamPorts[idx] = new MemSidePort(portName, this, STREAM_PORT, idx);
         }
         return *streamPorts[idx];
     } else if (if_name == "spm") {
@@ -940,43 +1135,29 @@ CommInterface::getPort(const std::string& if_name, PortID idx) {
     }
 }
 
-MemoryRequest *
-CommInterface::findMemRequest(PacketPtr pkt, bool isRead) {
-    if (isRead) {
-        for (auto it=accRdQ.begin(); it!=accRdQ.end(); ++it) {
-            if ((*it)->pkt == pkt) {
-                return (*it);
-            }
-        }
-    } else {
-        for (auto it=accWrQ.begin(); it!=accWrQ.end(); ++it) {
-            if ((*it)->pkt == pkt) {
-                return (*it);
-            }
-        }
-    }
-    panic("Could not find memory request in request queues");
-    return NULL;
-}
-
 void
-CommInterface::clearMemRequest(MemoryRequest * req, bool isRead) {
-    if (isRead) {
-        for (auto it=accRdQ.begin(); it!=accRdQ.end(); ++it) {
-            if ((*it) == req) {
-                it=accRdQ.erase(it);
-                break;
-            }
-        }
-    } else {
-        for (auto it=accWrQ.begin(); it!=accWrQ.end(); ++it) {
-            if ((*it) == req) {
-                it=accWrQ.erase(it);
-                break;
-            }
-        }
-    }
+CommInterface::trackMemRequest(PacketPtr pkt, MemoryRequest * req, PortType type, bool isRead) {
+    if (isRead) accRdQ[pkt] = {req, type};
+    else accWrQ[pkt] = {req, type};
 }
 
 void
-CommInterface::startup() {}
\ No newline at end of file
+CommInterface::startup() {}
+
+CommInterface::CommInterfaceStats::CommInterfaceStats(CommInterface &comm)
+    : statistics::Group(&comm),
+    ADD_STAT(memRequests, statistics::units::Count::get(),
+             "Memory requests queued by the compute unit"),
+    ADD_STAT(memBursts, statistics::units::Count::get(),
+             "Memory requests queued for the ports after coalescing"),
+    ADD_STAT(coalescingRatio, statistics::units::Ratio::get(),
+             "Average number of compute unit requests served per burst"),
+    ADD_STAT(atomicRequests, statistics::units::Count::get(),
+             "Atomic read-modify-write packets issued"),
+    ADD_STAT(functionalRequests, statistics::units::Count::get(),
+             "Requests served through functional accesses"),
+    ADD_STAT(functionalBytes, statistics::units::Byte::get(),
+             "Bytes moved by functional accesses")
+{
+    coalescingRatio = memRequests / memBursts;
+}
\ No newline at end of file
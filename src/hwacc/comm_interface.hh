@@ -2,6 +2,8 @@
 #define __HWACC_COMM_INTERFACE_HH__
 
 #include "params/CommInterface.hh"
+#include "base/addr_range_map.hh"
+#include "base/statistics.hh"
 #include "dev/io_device.hh"
 #include "dev/arm/base_gic.hh"
 #include "hwacc/compute_unit.hh"
@@ -12,6 +14,7 @@
 
 #include <list>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 class CommInterface : public BasicPioDevice
@@ -36,12 +39,23 @@ class CommInterface : public BasicPioDevice
     bool debug() { return debugEnabled; }
 
   protected:
+    // Classes of request ports, in the priority used for address decode
+    enum PortType {
+        REG_PORT,
+        STREAM_PORT,
+        SPM_PORT,
+        LOCAL_PORT,
+        GLOBAL_PORT,
+        NUM_PORT_TYPES
+    };
+
     class MemSidePort : public StreamRequestPort
     {
       friend class CommInterface;
 
       private:
         CommInterface *owner;
+        PortType portType;
         std::queue<PacketPtr> outstandingPkts;
         MemoryRequest *readReq;
         MemoryRequest *writeReq;
@@ -49,8 +63,9 @@ class CommInterface : public BasicPioDevice
         bool writeActive;
 
       public:
-        MemSidePort(const std::string& name, CommInterface *owner, PortID id=InvalidPortID) :
-          StreamRequestPort(name, owner, id), owner(owner) {
+        MemSidePort(const std::string& name, CommInterface *owner, PortType type,
+                    PortID id=InvalidPortID) :
+          StreamRequestPort(name, owner, id), owner(owner), portType(type) {
           readActive = false;
           writeActive = false;
           readReq = NULL;
@@ -132,7 +147,7 @@ class CommInterface : public BasicPioDevice
         MemoryRequest *writeReq;
       public:
         RegPort(const std::string& name, CommInterface *_owner, PortID id=InvalidPortID) :
-          RequestPort(name, _owner), owner(_owner) {}
+          RequestPort(name, _owner), owner(_owner), readReq(nullptr), writeReq(nullptr) {}
         void setReadReq(MemoryRequest * req = nullptr) { readReq = req; }
         void setWriteReq(MemoryRequest * req = nullptr) { writeReq = req; }
       protected:
@@ -157,13 +172,53 @@ class CommInterface : public BasicPioDevice
         bool debug() { return comm->debug(); }
     };
 
-    std::list<MemoryRequest*> readQueue;
-    std::list<MemoryRequest*> writeQueue;
-    std::list<MemoryRequest*> accRdQ;
-    std::list<MemoryRequest*> accWrQ;
+    // Pending requests, pre-classified by the type of port that can serve them
+    std::vector<std::list<MemoryRequest*>> readQueues;
+    std::vector<std::list<MemoryRequest*>> writeQueues;
+
+    // In-flight requests, keyed by the packet carrying them
+    struct InFlightRequest {
+        MemoryRequest * req;
+        PortType type;
+    };
+    std::unordered_map<PacketPtr, InFlightRequest> accRdQ;
+    std::unordered_map<PacketPtr, InFlightRequest> accWrQ;
 
     int requestsInQueues;
 
+    // Requests enqueued since the last tick, merged into bursts by the coalescer
+    bool coalesceRequests;
+    unsigned maxBurstSize;
+    std::vector<MemoryRequest*> pendingReads;
+    std::vector<MemoryRequest*> pendingWrites;
+    void coalesce(std::vector<MemoryRequest*> &pending, bool read);
+    void commitRead(MemoryRequest * req);
+    void commitWrite(MemoryRequest * req);
+
+    struct CommInterfaceStats : public statistics::Group
+    {
+        CommInterfaceStats(CommInterface &comm);
+
+        /** Memory requests queued by the compute unit */
+        statistics::Scalar memRequests;
+        /** Requests queued for the ports after coalescing */
+        statistics::Scalar memBursts;
+        /** Average number of requests served by one burst */
+        statistics::Formula coalescingRatio;
+        /** Atomic read-modify-write packets issued */
+        statistics::Scalar atomicRequests;
+        /** Requests served through functional accesses */
+        statistics::Scalar functionalRequests;
+        /** Bytes moved by functional accesses */
+        statistics::Scalar functionalBytes;
+    } stats;
+
+    // Interval index over the port address ranges. Ranges that overlap an
+    // already indexed range are kept aside and searched in priority order
+    AddrRangeMap<PortType> portRangeIndex;
+    std::vector<std::pair<AddrRange, PortType>> overlappingRanges;
+    bool portRangesIndexed = false;
+
     std::vector<MemSidePort*> localPorts;
     std::vector<MemSidePort*> globalPorts;
     std::vector<MemSidePort*> streamPorts;
@@ -197,16 +252,25 @@ class CommInterface : public BasicPioDevice
     bool allPortsStalled() {
         return localPortsStalled() && globalPortsStalled() && streamPortsStalled() && spmPortsStalled();
     }
-    bool inStreamRange(Addr add);
-    bool inSPMRange(Addr add);
-    bool inRegRange(Addr add);
-    bool inLocalRange(Addr add);
-    bool inGlobalRange(Addr add);
+    void indexPortRanges();
+    PortType classifyAddress(Addr add);
+    bool inRegRange(Addr add) { return classifyAddress(add) == REG_PORT; }
+    size_t queuedRequests(const std::vector<std::list<MemoryRequest*>> &queues) {
+        size_t count = 0;
+        for (auto &queue : queues) count += queue.size();
+        return count;
+    }
+    size_t freePorts(PortType type, bool read);
+    RequestPort * getValidPort(PortType type, Addr add, size_t len, bool read);
+    void trackMemRequest(PacketPtr pkt, MemoryRequest * req, PortType type, bool isRead);
+    RequestPtr atomicRequest(MemoryRequest * readReq, int size);
     MemSidePort * getValidLocalPort(Addr add, bool read);
     MemSidePort * getValidGlobalPort(Addr add, bool read);
     MemSidePort * getValidStreamPort(Addr add, size_t len, bool read);
     SPMPort *     getValidSPMPort(Addr add, size_t len, bool read);
     RegPort *     getValidRegPort(Addr add);
+    RequestPort * getFunctionalPort(PortType type, Addr add);
+    void functionalAccess(Addr add, uint8_t * data, size_t len, bool read);
 
     CommInterface *comm;
     RequestorID masterId;
@@ -263,6 +327,12 @@ class CommInterface : public BasicPioDevice
 
     void enqueueWrite(MemoryRequest * req);
 
+    // Serve a request at once through functional accesses, bypassing the
+    // port queues. Used when the compute unit executes without timing
+    void functionalRead(MemoryRequest * req);
+
+    void functionalWrite(MemoryRequest * req);
+
     //uint8_t* getReadBuffer() { return readBuffer; }
 
     bool isRunning() { return running; }
@@ -278,8 +348,6 @@ class CommInterface : public BasicPioDevice
     void registerCompUnit(ComputeUnit *compunit) { cu = compunit; }
     virtual void finish();
 
-    MemoryRequest * findMemRequest(PacketPtr pkt, bool isRead);
-    void clearMemRequest(MemoryRequest * req, bool isRead);
     virtual void refreshMemPorts() {}
     std::string getName() const { return name(); }
 
@@ -0,0 +1,130 @@
+#include "hwacc/event_queue_bridge.hh"
+#include "base/trace.hh"
+#include "debug/EventQueueBridge.hh"
+
+EventQueueBridge::BridgeResponsePort::BridgeResponsePort(const std::string &_name,
+    EventQueueBridge * _bridge, EventManager &em) :
+    QueuedResponsePort(_name, _bridge, respQueue),
+    bridge(_bridge),
+    respQueue(em, *this)
+{
+    respQueue.disableSanityCheck();
+}
+
+bool
+EventQueueBridge::BridgeResponsePort::recvTimingReq(PacketPtr pkt) {
+    panic_if(pkt->cacheResponding(), "%s does not pass snoop responses\n", name());
+    DPRINTF(EventQueueBridge, "Request for 0x%lx crossing to queue %s\n",
+        pkt->getAddr(), bridge->memSideQueue->name());
+    bridge->stats.requests++;
+    EventQueueBridge * owner = bridge;
+    bridge->cross(bridge->memSideQueue, pkt, [owner](PacketPtr pkt, Tick when) {
+        owner->memSidePort.schedTimingReq(pkt, when);
+    });
+    return true;
+}
+
+Tick
+EventQueueBridge::BridgeResponsePort::recvAtomic(PacketPtr pkt) {
+    // Atomic accesses only happen outside of parallel timing, e.g. when
+    // fast forwarding. Borrow the other queue for the duration of the call
+    EventQueue::ScopedMigration migrate(bridge->memSideQueue);
+    return bridge->delay + bridge->memSidePort.sendAtomic(pkt);
+}
+
+void
+EventQueueBridge::BridgeResponsePort::recvFunctional(PacketPtr pkt) {
+    pkt->pushLabel(name());
+    if (trySatisfyFunctional(pkt)) {
+        pkt->popLabel();
+        return;
+    }
+    pkt->popLabel();
+    bridge->memSidePort.sendFunctional(pkt);
+}
+
+AddrRangeList
+EventQueueBridge::BridgeResponsePort::getAddrRanges() const {
+    return bridge->ranges;
+}
+
+EventQueueBridge::BridgeRequestPort::BridgeRequestPort(const std::string &_name,
+    EventQueueBridge * _bridge, EventManager &em) :
+    QueuedRequestPort(_name, _bridge, reqQueue, snoopRespQueue),
+    bridge(_bridge),
+    reqQueue(em, *this),
+    snoopRespQueue(em, *this)
+{
+    reqQueue.disableSanityCheck();
+}
+
+bool
+EventQueueBridge::BridgeRequestPort::recvTimingResp(PacketPtr pkt) {
+    DPRINTF(EventQueueBridge, "Response for 0x%lx crossing to queue %s\n",
+        pkt->getAddr(), bridge->cpuSideQueue->name());
+    bridge->stats.responses++;
+    EventQueueBridge * owner = bridge;
+    bridge->cross(bridge->cpuSideQueue, pkt, [owner](PacketPtr pkt, Tick when) {
+        owner->cpuSidePort.schedTimingResp(pkt, when);
+    });
+    return true;
+}
+
+void
+EventQueueBridge::BridgeRequestPort::recvRangeChange() {
+    bridge->cpuSidePort.sendRangeChange();
+}
+
+EventQueueBridge::EventQueueBridge(const EventQueueBridgeParams &p) :
+    SimObject(p),
+    cpuSideQueue(getEventQueue(p.cpu_side_eventq)),
+    memSideQueue(getEventQueue(p.mem_side_eventq)),
+    cpuSideManager(cpuSideQueue),
+    memSideManager(memSideQueue),
+    cpuSidePort(name() + ".cpu_side", this, cpuSideManager),
+    memSidePort(name() + ".mem_side", this, memSideManager),
+    delay(p.delay),
+    ranges(p.ranges.begin(), p.ranges.end()),
+    stats(*this)
+{
+}
+
+void
+EventQueueBridge::init() {
+    SimObject::init();
+    fatal_if(!cpuSidePort.isConnected() || !memSidePort.isConnected(),
+        "Both ports of %s need to be connected\n", name());
+    fatal_if(cpuSideQueue != memSideQueue && delay < simQuantum,
+        "%s crosses event queues with a delay of %lu ticks, below the sim quantum of %lu\n",
+        name(), delay, simQuantum);
+    cpuSidePort.sendRangeChange();
+}
+
+void
+EventQueueBridge::cross(EventQueue * target, PacketPtr pkt,
+                        std::function<void(PacketPtr, Tick)> deliver) {
+    Tick when = curTick() + delay + pkt->headerDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+    // Scheduling on a queue owned by another thread goes through its async
+    // list and is inserted at the next quantum barrier
+    auto crossing = new EventFunctionWrapper([pkt, deliver]() {
+        deliver(pkt, curTick());
+    }, name() + ".crossing", true);
+    target->schedule(crossing, when);
+}
+
+Port &
+EventQueueBridge::getPort(const std::string &if_name, PortID idx) {
+    if (if_name == "cpu_side") return cpuSidePort;
+    else if (if_name == "mem_side") return memSidePort;
+    else return SimObject::getPort(if_name, idx);
+}
+
+EventQueueBridge::EventQueueBridgeStats::EventQueueBridgeStats(EventQueueBridge &bridge)
+    : statistics::Group(&bridge),
+    ADD_STAT(requests, statistics::units::Count::get(),
+             "Requests handed to the mem side event queue"),
+    ADD_STAT(responses, statistics::units::Count::get(),
+             "Responses handed back to the cpu side event queue")
+{
+}
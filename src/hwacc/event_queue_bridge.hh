@@ -0,0 +1,87 @@
+#ifndef __HWACC_EVENT_QUEUE_BRIDGE_HH__
+#define __HWACC_EVENT_QUEUE_BRIDGE_HH__
+
+#include "base/statistics.hh"
+#include "mem/packet_queue.hh"
+#include "mem/qport.hh"
+#include "params/EventQueueBridge.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+#include <functional>
+
+using namespace gem5;
+
+/***************************************************************************************
+ * EventQueueBridge joins two sides of the memory system that are simulated on
+ * different event queues, e.g. an accelerator and its private SPM on their own
+ * host thread and the cluster xbar on the main one. Packets are handed across by
+ * scheduling them on the other queue at least one sim quantum in the future,
+ * so they are inserted at the next quantum barrier and never land in the
+ * past of the receiving queue. Each side only ever touches its own packet queue.
+ **************************************************************************************/
+class EventQueueBridge : public SimObject
+{
+  private:
+    class BridgeResponsePort : public QueuedResponsePort
+    {
+      private:
+        EventQueueBridge * bridge;
+        RespPacketQueue respQueue;
+      public:
+        BridgeResponsePort(const std::string &_name, EventQueueBridge * _bridge,
+                           EventManager &em);
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    class BridgeRequestPort : public QueuedRequestPort
+    {
+      private:
+        EventQueueBridge * bridge;
+        ReqPacketQueue reqQueue;
+        SnoopRespPacketQueue snoopRespQueue;
+      public:
+        BridgeRequestPort(const std::string &_name, EventQueueBridge * _bridge,
+                          EventManager &em);
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvRangeChange() override;
+    };
+
+    EventQueue * cpuSideQueue;
+    EventQueue * memSideQueue;
+    // Packet queues schedule their send events on the queue of their own side
+    EventManager cpuSideManager;
+    EventManager memSideManager;
+    BridgeResponsePort cpuSidePort;
+    BridgeRequestPort memSidePort;
+    const Tick delay;
+    const AddrRangeList ranges;
+
+    void cross(EventQueue * target, PacketPtr pkt, std::function<void(PacketPtr, Tick)> deliver);
+
+  protected:
+    // Each counter is only updated by the thread of its own side
+    struct EventQueueBridgeStats : public statistics::Group
+    {
+        EventQueueBridgeStats(EventQueueBridge &bridge);
+        /** Requests handed to the mem side queue */
+        statistics::Scalar requests;
+        /** Responses handed back to the cpu side queue */
+        statistics::Scalar responses;
+    } stats;
+
+  public:
+    PARAMS(EventQueueBridge);
+    EventQueueBridge(const EventQueueBridgeParams &p);
+
+    void init() override;
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+};
+
+#endif // __HWACC_EVENT_QUEUE_BRIDGE_HH__
@@ -5,12 +5,233 @@ LLVMInterface::LLVMInterface(const LLVMInterfaceParams &p):
     ComputeUnit(p),
     filename(p.in_file),
     topName(p.top_name),
+    irCacheDir(p.ir_cache_dir),
+    irCacheHit(false),
+    instanceLimits(parseInstanceLimits(p.function_instance_limits)),
+    pipelineConfig(parsePipelineLoops(p.pipeline_loops)),
+    pipelineMaxOverlap(p.pipeline_max_overlap),
     scheduling_threshold(p.sched_threshold),
     clock_period(p.clock_period),
-    lockstep(p.lockstep_mode) {
+    lockstep(p.lockstep_mode),
+    storeForwarding(p.store_forwarding),
+    functionalLimit(p.functional_invocations),
+    functionalMode(p.functional_invocations != 0),
+    functionalRun(false),
+    invocations(0),
+    functionalInsts(0),
+    jitCompute(p.jit_compute),
+    samplingPeriod(p.sampling_period),
+    sampleWarmup(p.sample_warmup),
+    sampleSize(p.sample_size),
+    samplingConfig(p.sampled_loops.begin(), p.sampled_loops.end()),
+    extrapolatedCycles(0),
+    extrapolationError(0),
+    stats(*this) {
     // if (DTRACE(Trace)) DPRINTF(Runtime, "Trace: %s \n", __PRETTY_FUNCTION__);
     clock_period = clock_period * 1000;
     dbg = comm->debug();
+    if (p.memory_order == "relaxed") memoryOrder = RELAXED;
+    else if (p.memory_order == "tso") memoryOrder = TSO;
+    else if (p.memory_order == "strict") memoryOrder = STRICT;
+    else fatal("Unknown memory ordering policy: %s\n", p.memory_order);
+    if (samplingPeriod > 0) {
+        // The measured unit starts at the end of a detailed iteration
+        if (sampleWarmup == 0)
+            fatal("Loop sampling needs at least one warmup iteration\n");
+        if (sampleSize == 0)
+            fatal("Loop sampling needs at least one measured iteration\n");
+        if (samplingPeriod < sampleWarmup + sampleSize)
+            fatal("Sampling period of %d iterations is shorter than its %d warmup and %d measured iterations\n",
+                samplingPeriod, sampleWarmup, sampleSize);
+    }
+    for (auto &entry : samplingConfig) {
+        auto split = entry.find(':');
+        if (split == std::string::npos || split == 0 || split + 1 == entry.size())
+            fatal("Malformed sampled loop '%s', expected function:header_block\n", entry);
+    }
+}
+
+std::vector<std::pair<std::string, unsigned>>
+LLVMInterface::parseInstanceLimits(const std::vector<std::string> &entries)
+{
+    std::vector<std::pair<std::string, unsigned>> limits;
+    for (auto &entry : entries) {
+        auto split = entry.rfind(':');
+        if (split == std::string::npos || split == 0 || split + 1 == entry.size())
+            fatal("Malformed function instance limit '%s', expected name:limit\n", entry);
+        std::string name = entry.substr(0, split);
+        std::string count = entry.substr(split + 1);
+        if (count.find_first_not_of("0123456789") != std::string::npos)
+            fatal("Malformed function instance limit '%s', expected name:limit\n", entry);
+        unsigned limit = std::stoul(count);
+        if (limit == 0)
+            fatal("Function %s needs an instance limit of at least 1\n", name);
+        limits.push_back({name, limit});
+    }
+    return limits;
+}
+
+std::map<std::string, std::pair<unsigned, unsigned>>
+LLVMInterface::parsePipelineLoops(const std::vector<std::string> &entries)
+{
+    std::map<std::string, std::pair<unsigned, unsigned>> loops;
+    for (auto &entry : entries) {
+        std::vector<std::string> fields;
+        std::stringstream stream(entry);
+        std::string field;
+        while (std::getline(stream, field, ':')) fields.push_back(field);
+        if (fields.size() < 3 || fields.size() > 4 || fields[0].empty() || fields[1].empty())
+            fatal("Malformed pipelined loop '%s', expected function:header_block:ii[:max_overlap]\n", entry);
+        for (size_t i = 2; i < fields.size(); i++) {
+            if (fields[i].empty() || fields[i].find_first_not_of("0123456789") != std::string::npos)
+                fatal("Malformed pipelined loop '%s', expected function:header_block:ii[:max_overlap]\n", entry);
+        }
+        unsigned ii = std::stoul(fields[2]);
+        unsigned overlap = (fields.size() == 4) ? std::stoul(fields[3]) : 0;
+        if (ii == 0) fatal("Pipelined loop %s needs an initiation interval of at least 1\n", entry);
+        loops[fields[0] + ":" + fields[1]] = {ii, overlap};
+    }
+    return loops;
+}
+
+LLVMInterface::LLVMInterfaceStats::LLVMInterfaceStats(LLVMInterface &llvm_interface)
+    : statistics::Group(&llvm_interface),
+    ADD_STAT(instancesAllocated, statistics::units::Count::get(),
+             "Dynamic instruction instances allocated"),
+    ADD_STAT(instancesRecycled, statistics::units::Count::get(),
+             "Dynamic instruction instances reused from the instance pools"),
+    ADD_STAT(instanceRecycleRate, statistics::units::Ratio::get(),
+             "Fraction of scheduled instruction instances that were recycled",
+             instancesRecycled / (instancesAllocated + instancesRecycled)),
+    ADD_STAT(fuStalls, statistics::units::Count::get(),
+             "Cycles an instruction waited on a busy functional unit"),
+    ADD_STAT(forwardedLoads, statistics::units::Count::get(),
+             "Loads served by forwarding from an in-flight store"),
+    ADD_STAT(rawStalls, statistics::units::Count::get(),
+             "Loads held for an overlapping in-flight store"),
+    ADD_STAT(warStalls, statistics::units::Count::get(),
+             "Stores held for an overlapping in-flight load"),
+    ADD_STAT(wawStalls, statistics::units::Count::get(),
+             "Stores held for an overlapping in-flight store"),
+    ADD_STAT(orderingStalls, statistics::units::Count::get(),
+             "Cycles a memory access was held back by the ordering policy"),
+    ADD_STAT(hazardStalls, statistics::units::Count::get(),
+             "Memory accesses held for a read or write hazard",
+             rawStalls + warStalls + wawStalls),
+    ADD_STAT(staticFootprint, statistics::units::Byte::get(),
+             "Bytes held by the shared static instruction descriptors"),
+    ADD_STAT(dynamicFootprint, statistics::units::Byte::get(),
+             "Approximate bytes held by pooled dynamic instruction instances"),
+    ADD_STAT(functionLaunches, statistics::units::Count::get(),
+             "Function instances launched"),
+    ADD_STAT(callStalls, statistics::units::Count::get(),
+             "Cycles a call waited for a free instance of its callee"),
+    ADD_STAT(activeFunctionInstances, statistics::units::Count::get(),
+             "Function instances active per cycle"),
+    ADD_STAT(instanceLaunches, statistics::units::Count::get(),
+             "Launches of each function with a configured instance limit"),
+    ADD_STAT(instanceStalls, statistics::units::Count::get(),
+             "Call stalls of each function with a configured instance limit"),
+    ADD_STAT(pipelinedIterations, statistics::units::Count::get(),
+             "Iterations launched by pipelined loops"),
+    ADD_STAT(pipelineIIStalls, statistics::units::Count::get(),
+             "Cycles pipelined loop iterations waited for the initiation interval"),
+    ADD_STAT(pipelineOverlapStalls, statistics::units::Count::get(),
+             "Cycles pipelined loop iterations waited for an overlap slot"),
+    ADD_STAT(bursts, statistics::units::Count::get(),
+             "Bulk memory intrinsics issued as bursts"),
+    ADD_STAT(burstBytes, statistics::units::Byte::get(),
+             "Bytes moved or set by bulk memory intrinsics"),
+    ADD_STAT(burstStalls, statistics::units::Count::get(),
+             "Cycles a bulk memory intrinsic waited for overlapping accesses"),
+    ADD_STAT(atomicOps, statistics::units::Count::get(),
+             "Atomic read-modify-writes and compare-exchanges issued"),
+    ADD_STAT(atomicStalls, statistics::units::Count::get(),
+             "Atomics held for an overlapping in-flight access"),
+    ADD_STAT(casFailures, statistics::units::Count::get(),
+             "Compare-exchanges that found an unexpected value"),
+    ADD_STAT(atomicLatency, statistics::units::Cycle::get(),
+             "Cycles from issue to response of each atomic"),
+    ADD_STAT(functionalInvocations, statistics::units::Count::get(),
+             "Invocations executed functionally"),
+    ADD_STAT(functionalInsts, statistics::units::Count::get(),
+             "Instructions executed functionally"),
+    ADD_STAT(functionalHostSeconds, statistics::units::Second::get(),
+             "Host seconds spent executing functionally"),
+    ADD_STAT(functionalIPS, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Second>::get(),
+             "Functionally executed instructions per host second",
+             functionalInsts / functionalHostSeconds),
+    ADD_STAT(jitBlocks, statistics::units::Count::get(),
+             "Basic blocks compiled by the block JIT"),
+    ADD_STAT(jitKernels, statistics::units::Count::get(),
+             "Static instructions evaluated through JIT kernels"),
+    ADD_STAT(jitCompileSeconds, statistics::units::Second::get(),
+             "Host seconds spent compiling basic blocks"),
+    ADD_STAT(sampledUnits, statistics::units::Count::get(),
+             "Sampling units measured in detail"),
+    ADD_STAT(sampledIterations, statistics::units::Count::get(),
+             "Loop iterations measured by sampling units"),
+    ADD_STAT(fastForwardedIterations, statistics::units::Count::get(),
+             "Loop iterations fast-forwarded functionally"),
+    ADD_STAT(fastForwardedInsts, statistics::units::Count::get(),
+             "Instructions executed while fast-forwarding"),
+    ADD_STAT(extrapolatedCycles, statistics::units::Cycle::get(),
+             "Cycles with fast-forwarded iterations costed at the sampled rate"),
+    ADD_STAT(extrapolationError, statistics::units::Cycle::get(),
+             "Half-width of the 95% confidence interval of the extrapolated cycles")
+{
+    staticFootprint.functor([&llvm_interface]() {
+        size_t bytes = 0;
+        for (auto value : llvm_interface.values) {
+            if (auto inst = std::dynamic_pointer_cast<SALAM::Instruction>(value))
+                bytes += inst->getStaticFootprint();
+        }
+        return bytes;
+    });
+    dynamicFootprint.functor([&llvm_interface]() {
+        size_t bytes = 0;
+        for (auto &pool : llvm_interface.instancePools) {
+            for (auto &inst : pool.instances) bytes += inst->getDynamicFootprint();
+        }
+        return bytes;
+    });
+    // Stats are indexed by functional unit enum value
+    uint32_t fu_count = 0;
+    for (auto fu : llvm_interface.hw->functional_units->functional_unit_list) {
+        fu_count = std::max(fu_count, fu->get_enum_value() + 1);
+    }
+    fuStalls.init(fu_count);
+    fuOccupancy.resize(fu_count, nullptr);
+    for (auto fu : llvm_interface.hw->functional_units->functional_unit_list) {
+        auto fu_id = fu->get_enum_value();
+        fuStalls.subname(fu_id, fu->get_alias());
+        fuOccupancy[fu_id] = new statistics::Histogram(this,
+            ("fuOccupancy_" + fu->get_alias()).c_str(),
+            statistics::units::Count::get(),
+            ("Units of " + fu->get_alias() + " in use per cycle").c_str());
+        fuOccupancy[fu_id]->init(16);
+    }
+    fuStalls.flags(statistics::nozero);
+    activeFunctionInstances.init(16);
+    atomicLatency.init(16);
+    // Functions are parsed after stats registration, so per function stats
+    // follow the configured instance limits
+    auto &limits = llvm_interface.instanceLimits;
+    if (!limits.empty()) {
+        instanceLaunches.init(limits.size());
+        instanceStalls.init(limits.size());
+    }
+    for (size_t i = 0; i < limits.size(); i++) {
+        auto &name = limits.at(i).first;
+        instanceLaunches.subname(i, name);
+        instanceStalls.subname(i, name);
+        instanceOccupancy.push_back(new statistics::Histogram(this,
+            ("instanceOccupancy_" + name).c_str(),
+            statistics::units::Count::get(),
+            ("Active instances of " + name + " per cycle").c_str()));
+        instanceOccupancy.back()->init(limits.at(i).second + 1);
+    }
 }
 
 std::shared_ptr<SALAM::Value> createClone(const std::shared_ptr<SALAM::Value>& b)
@@ -20,6 +241,34 @@ std::shared_ptr<SALAM::Value> createClone(const std::shared_ptr<SALAM::Value>& b
     return clone;
 }
 
+std::shared_ptr<SALAM::Instruction>
+LLVMInterface::acquireInstance(std::shared_ptr<SALAM::Instruction> inst,
+                               bool isolate)
+{
+    auto &pool = instancePools.at(inst->getUID());
+    SALAM::Instruction * instance;
+    if (!pool.free.empty()) {
+        instance = pool.free.back();
+        pool.free.pop_back();
+        instance->recycle();
+        stats.instancesRecycled++;
+    } else {
+        auto clone_inst = inst->clone();
+        // Clones share the static register unless several instances of the
+        // function may be live at once
+        if (isolate) clone_inst->isolateRegister();
+        pool.instances.push_back(clone_inst);
+        stats.instancesAllocated++;
+        instance = clone_inst.get();
+    }
+    // The pool keeps ownership. Releasing the last reference frees the
+    // instance for the next acquire instead of deleting it
+    InstancePool * owner = &pool;
+    return std::shared_ptr<SALAM::Instruction>(instance, [owner](SALAM::Instruction * freed) {
+        owner->free.push_back(freed);
+    });
+}
+
 void
 LLVMInterface::ActiveFunction::scheduleBB(std::shared_ptr<SALAM::BasicBlock> bb)
 {
@@ -27,10 +276,17 @@ LLVMInterface::ActiveFunction::scheduleBB(std::shared_ptr<SALAM::BasicBlock> bb)
     if (dbg) DPRINTFS(Runtime, owner, "|---[Schedule BB - UID:%i ]\n", bb->getUID());
     bool needToScheduleBranch = false;
     std::shared_ptr<SALAM::BasicBlock> nextBB;
+    bool concurrent = func->isConcurrent();
+    if (concurrent) {
+        // Another instance may have overwritten the shared argument registers
+        for (size_t i = 0; i < argSnapshot.size(); i++) {
+            func->getArguments()->at(i)->setRegisterValue(argSnapshot.at(i).getLockedData());
+        }
+    }
     auto instruction_list = *(bb->Instructions());
     for (auto inst : instruction_list) {
-        std::shared_ptr<SALAM::Instruction> clone_inst = inst->clone();
-        if (dbg) DPRINTFS(Runtime, owner,  "\t\t Instruction Cloned [UID: %d] \n", inst->getUID());
+        std::shared_ptr<SALAM::Instruction> clone_inst = owner->acquireInstance(inst, concurrent);
+        if (dbg) DPRINTFS(Runtime, owner,  "\t\t Instruction Instanced [UID: %d] \n", inst->getUID());
         if (clone_inst->isBr()) {
             if (dbg) DPRINTFS(Runtime, owner,  "\t\t Branch Instruction Found\n");
             auto branch = std::dynamic_pointer_cast<SALAM::Br>(clone_inst);
@@ -41,7 +297,7 @@ LLVMInterface::ActiveFunction::scheduleBB(std::shared_ptr<SALAM::BasicBlock> bb)
                 needToScheduleBranch = true;
             } else {
                 findDynamicDeps(clone_inst);
-                reservation.push_back(clone_inst);
+                reserve(clone_inst);
             }
         } else {
             if (clone_inst->isPhi()) {
@@ -50,7 +306,7 @@ LLVMInterface::ActiveFunction::scheduleBB(std::shared_ptr<SALAM::BasicBlock> bb)
                 if (phi) phi->setPrevBB(previousBB);
             }
             findDynamicDeps(clone_inst);
-            reservation.push_back(clone_inst);
+            reserve(clone_inst);
         }
     }
     previousBB = bb;
@@ -67,7 +323,6 @@ LLVMInterface::ActiveFunction::processQueues()
     if (owner->hw->hw_statistics->use_cycle_tracking()) {
         auto hwStart = std::chrono::high_resolution_clock::now();
         hw_cycle_stats.reset();
-        owner->hw->hw_statistics->updateHWStatsCycleStart();
         
         // Update Params
         hw_cycle_stats.cycle = owner->cycle;
@@ -96,8 +351,7 @@ LLVMInterface::ActiveFunction::processQueues()
         );
 
         if((queue_iter->second)->commit()) {
-            (queue_iter->second)->reset();
-            queue_iter = computeQueue.erase(queue_iter);
+            queue_iter = dequeue(computeQueue, queue_iter);
             hw_cycle_stats.compCommited++;
         } else {
             ++queue_iter;
@@ -110,9 +364,9 @@ LLVMInterface::ActiveFunction::processQueues()
         if (caller != nullptr) {
             // Signal the calling instruction
             if (caller->getSize() > 0) {
-                auto retInst = reservation.front();
-                auto retOperand = retInst->getOperands()->front();
-                caller->setRegisterValue(retOperand.getOpRegister());
+                auto retInst = reservation.begin()->second;
+                auto &retOperand = retInst->getOperands()->front();
+                caller->setRegisterValue(retOperand.getLockedData());
             }
             func->removeInstance();
             caller->commit();
@@ -120,11 +374,12 @@ LLVMInterface::ActiveFunction::processQueues()
         returned = true;
         return;
     } else if (lockstepReady()) {
-        // TODO: Look into for_each here
-        for (auto queue_iter = reservation.begin(); queue_iter != reservation.end();) {
+        // Only instances whose dependencies have resolved are visited. Users are
+        // woken into the ready queue by Instruction::signalUsers()
+        for (auto queue_iter = readyQueue.begin(); queue_iter != readyQueue.end();) {
             if (owner->debug())
                 if (dbg) DPRINTFS(Runtime, owner,  "Debug Breakpoint");
-            auto inst = *queue_iter;
+            auto inst = queue_iter->second;
             if (dbg) DPRINTFS(Runtime, owner,  "\n\t\t %s \n\t\t %s%s%s%d%s \n",
                 " |-[Reserve Queue]--------------",
                 " | Instruction: ", llvm::Instruction::getOpcodeName((inst)->getOpode()),
@@ -138,47 +393,108 @@ LLVMInterface::ActiveFunction::processQueues()
                         // RAW protection to ensure a writeback finishes before reading that location
                         if (inst->isLoadingInternal()) {
                             launchRead(inst);
-                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((*queue_iter)->getOpode()), (*queue_iter)->getUID());
-                            queue_iter = reservation.erase(queue_iter);
+                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                            queue_iter = unreserve(queue_iter);
                             hw_cycle_stats.loadInternal++;
-                        } else if (!writeActive(inst->getPtrOperandValue(0))) {
-                            launchRead(inst);
-                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((*queue_iter)->getOpode()), (*queue_iter)->getUID());
-                            queue_iter = reservation.erase(queue_iter);
-                            hw_cycle_stats.loadAcitve++;
-                        } else {
-                            auto activeWrite = getActiveWrite(inst->getPtrOperandValue(0));
-                            inst->addRuntimeDependency(activeWrite);
-                            activeWrite->addRuntimeUser(inst);
+                        } else if (orderingStall(inst)) {
+                            owner->stats.orderingStalls++;
                             ++queue_iter;
-                            hw_cycle_stats.loadRawStall++;
+                        } else {
+                            Addr loadAddr = inst->getPtrOperandValue(0);
+                            size_t loadSize = inst->getSizeInBytes();
+                            auto store = inflightStores.youngestOverlap(loadAddr, loadSize);
+                            if (store == nullptr) {
+                                launchRead(inst);
+                                if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                                queue_iter = unreserve(queue_iter);
+                                hw_cycle_stats.loadAcitve++;
+                            } else if (owner->storeForwarding && store->inst->isStore() &&
+                                       store->covers(loadAddr, loadSize)) {
+                                forwardStore(inst, *store);
+                                if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                                queue_iter = unreserve(queue_iter);
+                                owner->stats.forwardedLoads++;
+                            } else {
+                                // RAW, sleep until the store commits and wakes this load
+                                if (inst->addRuntimeDependency(store->inst)) store->inst->addRuntimeUser(inst);
+                                queue_iter = readyQueue.erase(queue_iter);
+                                hw_cycle_stats.loadRawStall++;
+                                owner->stats.rawStalls++;
+                            }
                         }
                     } else if ((inst)->isStore()) {
-                        // WAR Protection to insure reading finishes before a write
-                        // if (!readActive(inst->getPtrOperandValue(1))) {
-                        launchWrite(inst);
-                        if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((*queue_iter)->getOpode()), (*queue_iter)->getUID());
-                        queue_iter = reservation.erase(queue_iter);
-                        hw_cycle_stats.storeActive++;
-                        // } else {
-                        //     auto activeRead = getActiveRead(inst->getPtrOperandValue(1));
-                        //     inst->addRuntimeDependency(activeRead);
-                        //     activeRead->addRuntimeUser(inst);
-                        //     ++queue_iter;
-                        // }
-                    } else if ((inst)->isLatchingBrExiting() && ((reservation.size() > 1) || !queuesClear())) {
+                        Addr storeAddr = inst->getPtrOperandValue(1);
+                        size_t storeSize = (*inst->getOperands())[0].getSizeInBytes();
+                        MemAccess * hazard = nullptr;
+                        if (orderingStall(inst)) {
+                            owner->stats.orderingStalls++;
+                            ++queue_iter;
+                        } else if ((hazard = inflightLoads.youngestOverlap(storeAddr, storeSize))) {
+                            // WAR, the store may not overtake a read of the same bytes
+                            if (inst->addRuntimeDependency(hazard->inst)) hazard->inst->addRuntimeUser(inst);
+                            queue_iter = readyQueue.erase(queue_iter);
+                            owner->stats.warStalls++;
+                        } else if ((hazard = inflightStores.youngestOverlap(storeAddr, storeSize))) {
+                            // WAW, writes to the same bytes complete in program order
+                            if (inst->addRuntimeDependency(hazard->inst)) hazard->inst->addRuntimeUser(inst);
+                            queue_iter = readyQueue.erase(queue_iter);
+                            owner->stats.wawStalls++;
+                        } else {
+                            launchWrite(inst);
+                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                            queue_iter = unreserve(queue_iter);
+                            hw_cycle_stats.storeActive++;
+                        }
+                    } else if ((inst)->isLatchingBrExiting() && latchStall(inst)) {
+                        ++queue_iter;
+                    } else if ((inst)->isTerminator() && samplingStall(inst)) {
                         ++queue_iter;
                     } else if ((inst)->isTerminator()) {
                         (inst)->launch();
+                        if (inst->isLatchingBr()) recordLatch(inst);
                         auto nextBB = inst->getTarget();
+                        if (!owner->sampledLoops.empty()) nextBB = sampleIteration(inst, nextBB);
                         if (dbg) DPRINTFS(RuntimeCompute, owner, "\t\t Branching to %s from %s\n",
                             nextBB->getIRStub(), previousBB->getIRStub());
                         scheduleBB(nextBB);
                         if (dbg) DPRINTFS(Runtime, owner,  "\t\t  | Branch Scheduled: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((inst)->getOpode()), (inst)->getUID());
                         (inst)->commit();
-                        if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((*queue_iter)->getOpode()), (*queue_iter)->getUID());
-                        queue_iter = reservation.erase(queue_iter);
-                    } else if ((*queue_iter)->isCall()) {
+                        if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                        queue_iter = unreserve(queue_iter);
+                    } else if (inst->isAtomic()) {
+                        Addr atomicAddr = inst->getPtrOperandValue(0);
+                        size_t atomicSize = inst->isCmpXchg() ?
+                            std::static_pointer_cast<SALAM::CmpXchg>(inst)->getValueBytes() :
+                            inst->getSizeInBytes();
+                        MemAccess * hazard = nullptr;
+                        if (orderingStall(inst)) {
+                            owner->stats.orderingStalls++;
+                            ++queue_iter;
+                        } else if ((hazard = inflightStores.youngestOverlap(atomicAddr, atomicSize)) ||
+                                   (hazard = inflightLoads.youngestOverlap(atomicAddr, atomicSize))) {
+                            // Atomics read and write, sleep until the overlapping access commits
+                            if (inst->addRuntimeDependency(hazard->inst)) hazard->inst->addRuntimeUser(inst);
+                            queue_iter = readyQueue.erase(queue_iter);
+                            owner->stats.atomicStalls++;
+                        } else {
+                            launchAtomic(inst);
+                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                            queue_iter = unreserve(queue_iter);
+                        }
+                    } else if (inst->isMemoryIntrinsic()) {
+                        auto callInst = std::static_pointer_cast<SALAM::Call>(inst);
+                        if (orderingStall(inst)) {
+                            owner->stats.orderingStalls++;
+                            ++queue_iter;
+                        } else if (burstHazard(callInst)) {
+                            owner->stats.burstStalls++;
+                            ++queue_iter;
+                        } else {
+                            launchBurst(callInst);
+                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                            queue_iter = unreserve(queue_iter);
+                        }
+                    } else if (inst->isCall() && !std::static_pointer_cast<SALAM::Call>(inst)->isIntrinsic()) {
                         auto callInst = std::dynamic_pointer_cast<SALAM::Call>(inst);
                         assert(callInst);
                         auto calleeValue = callInst->getCalleeValue();
@@ -186,25 +502,34 @@ LLVMInterface::ActiveFunction::processQueues()
                         assert(callee);
                         if (callee->canLaunch()) {
                             owner->launchFunction(callee, callInst);
-                            computeQueue.insert({(inst)->getUID(), inst});
-                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((*queue_iter)->getOpode()), (*queue_iter)->getUID());
-                            queue_iter = reservation.erase(queue_iter);
+                            enqueue(computeQueue, inst->getUID(), inst);
+                            if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                            queue_iter = unreserve(queue_iter);
                         } else {
+                            owner->stats.callStalls++;
+                            int limited = owner->limitedFunctionIndex(callee);
+                            if (limited >= 0) owner->stats.instanceStalls[limited]++;
                             ++queue_iter;
                         }
+                    } else if (!(inst)->acquireFunctionalUnit()) {
+                        // Every unit of this type is occupied, retry next cycle
+                        owner->stats.fuStalls[inst->getFunctionalUnit()]++;
+                        ++queue_iter;
                     } else {
                         auto computeStart = std::chrono::high_resolution_clock::now();
                         if (!(inst)->launch()) {
                             if (dbg) DPRINTFS(Runtime, owner,  "\t\t  | Added to Compute Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((inst)->getOpode()), (inst)->getUID());
-                            computeQueue.insert({(inst)->getUID(), inst});
+                            enqueue(computeQueue, inst->getUID(), inst);
                             hw_cycle_stats.compLaunched++;
                         }
                         auto computeStop = std::chrono::high_resolution_clock::now();
                         owner->addComputeTime(computeStop-computeStart);
-                        if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName((*queue_iter)->getOpode()), (*queue_iter)->getUID());
-                        queue_iter = reservation.erase(queue_iter);
+                        if (dbg) DPRINTFS(Runtime, owner,  "\t\t  |-Erase From Queue: %s - UID[%i]\n", llvm::Instruction::getOpcodeName(inst->getOpode()), inst->getUID());
+                        queue_iter = unreserve(queue_iter);
                         hw_cycle_stats.compActive++;
                     }
+                } else if (!(inst)->ready()) {
+                    queue_iter = readyQueue.erase(queue_iter);
                 } else {
                     ++queue_iter;
                 }
@@ -216,13 +541,7 @@ LLVMInterface::ActiveFunction::processQueues()
 
     if (owner->hw->hw_statistics->use_cycle_tracking()) {
         auto hwStart = std::chrono::high_resolution_clock::now();
-        for (auto fu : hw->functional_units->functional_unit_list) {
-            std::cout << fu->get_alias() << " - " << fu->get_in_use() << "\n";
-        }
-
-
-
-        owner->hw->hw_statistics->updateHWStatsCycleEnd(owner->cycle);
+        owner->hw->hw_statistics->addCycleStats(hw_cycle_stats);
         auto hwStop = std::chrono::high_resolution_clock::now();
         owner->addHWTime(hwStop-hwStart);
     }
@@ -250,6 +569,12 @@ LLVMInterface::ActiveFunction::processQueues()
 void
 LLVMInterface::tick()
 {
+    if (functionalRun) {
+        // The invocation already executed, signal completion a cycle after it started
+        running = false;
+        finalize();
+        return;
+    }
     auto tickStart = std::chrono::high_resolution_clock::now();
 
     if (dbg) DPRINTF(LLVMInterface, "\n%s\n%s %d\n%s\n",
@@ -258,6 +583,9 @@ LLVMInterface::tick()
         "********************************************************************************");
     cycle++;
 
+    bool cycle_tracking = hw->hw_statistics->use_cycle_tracking();
+    if (cycle_tracking) hw->hw_statistics->updateHWStatsCycleStart();
+
     // Process Queues in Active Functions
     for (auto func_iter = activeFunctions.begin(); func_iter != activeFunctions.end();) {
         func_iter->processQueues();
@@ -267,6 +595,17 @@ LLVMInterface::tick()
             func_iter = activeFunctions.erase(func_iter);
         }
     }
+    size_t fu_index = 0;
+    for (auto fu : hw->functional_units->functional_unit_list) {
+        stats.fuOccupancy[fu->get_enum_value()]->sample(fu->get_in_use());
+        if (cycle_tracking) hw->hw_statistics->setFunctionalUnitUsage(fu_index++, fu->get_in_use());
+    }
+    if (cycle_tracking) hw->hw_statistics->updateHWStatsCycleEnd(cycle);
+    stats.activeFunctionInstances.sample(activeFunctions.size());
+    for (size_t i = 0; i < limitedFunctions.size(); i++) {
+        if (limitedFunctions.at(i))
+            stats.instanceOccupancy.at(i)->sample(limitedFunctions.at(i)->getActiveInstances());
+    }
     if (activeFunctions.empty()) {
         // We are finished executing all functions. Signal completion to the CommInterface
         running = false;
@@ -283,136 +622,31 @@ LLVMInterface::tick()
 
 
 /*********************************************************************************************
-- findDynamicDeps(std::list<std::shared_ptr<SALAM::Instructions>, std::shared_ptr<SALAM::Instruction>)
-- only parse queue once for each instruction until all dependencies are found
-- include self in dependency list
-- Register dynamicUser/dynamicDependencies std::deque<std::shared_ptr<SALAM::Instructon> >
+- findDynamicDeps(std::shared_ptr<SALAM::Instruction>)
+- the most recently scheduled instance of each static instruction is tracked in lastProducer
+- link to producers that have not committed, otherwise lock in the committed value
+- Register dynamicUser/dynamicDependencies links between the instances
 *********************************************************************************************/
-void // Add third argument, previous BB
+void
 LLVMInterface::ActiveFunction::findDynamicDeps(std::shared_ptr<SALAM::Instruction> inst)
 {
     // if (DTRACE(Trace)) if (dbg) DPRINTFS(Runtime, owner,  "Trace: %s \n", __PRETTY_FUNCTION__);
     if (dbg) DPRINTFS(Runtime, owner,  "Linking Dynamic Dependencies [%s]\n", llvm::Instruction::getOpcodeName(inst->getOpode()));
     // The list of UIDs for any dependencies we want to find
-    //std::deque<uint64_t> dep_uids = inst->runtimeInitialize();
-    std::vector<uint64_t> dep_uids = inst->runtimeInitialize();
-
-    // assert(inst->getDependencyCount() == 0);
-
-    // // An instruction is a runtime dependency for itself since multiple
-    // // instances of the same instruction shouldn't execute simultaneously
-    // // dep_uids.push_back(inst->getUID());
-
-    // Find dependencies currently in queues
-
-    // Reverse search the reservation queue because we want to link only the last instance of each dep
-    auto queue_iter = reservation.rbegin();
-    while ((queue_iter != reservation.rend()) && !dep_uids.empty()) {
-        auto queued_inst = *queue_iter;
-        // Look at each instruction in runtime queue once
-        for (auto dep_it = dep_uids.begin(); dep_it != dep_uids.end();) {
-            // Check if any of the instruction to be scheduled dependencies match the current instruction from queue
-            if (queued_inst->getUID() == *dep_it) {
-                // If dependency found, create two way link
-                inst->addRuntimeDependency(queued_inst);
-                queued_inst->addRuntimeUser(inst);
-                dep_it = dep_uids.erase(dep_it);
-            } else {
-                dep_it++;
-            }
-        }
-        queue_iter++;
-    }
-
-    // The other queues do not need to be reverse-searched since only 1 instance of any instruction can exist in them
-    // Check the compute queue
-    for (auto dep_it = dep_uids.begin(); dep_it != dep_uids.end();) {
-        auto queue_iter = computeQueue.find(*dep_it);
-        if (queue_iter != computeQueue.end()) {
-            auto queued_inst = queue_iter->second;
-            inst->addRuntimeDependency(queued_inst);
-            queued_inst->addRuntimeUser(inst);
-            dep_it = dep_uids.erase(dep_it);
-        } else {
-            dep_it++;
-        }
-    }
-    // Check the memory read queue
-    for (auto dep_it = dep_uids.begin(); dep_it != dep_uids.end();) {
-        auto queue_iter = readQueue.find(*dep_it);
-        if (queue_iter != readQueue.end()) {
-            auto queued_inst = queue_iter->second;
-            inst->addRuntimeDependency(queued_inst);
-            queued_inst->addRuntimeUser(inst);
-            dep_it = dep_uids.erase(dep_it);
-        } else {
-            dep_it++;
-        }
-    }
+    std::vector<uint64_t> dep_uids = inst->runtimeInitialize(registers.data());
 
-    // if (!dep_uids.empty()) {
-    //     // Check the memory read queue
-    //     // for (auto queued_read : readQueue) {
-    //     for (auto rq_it = readQueue.begin(); rq_it != readQueue.end(); rq_it++) {
-    //         auto queued_read = *rq_it;
-    //         auto queued_inst = queued_read.second;
-    //         // Look at each instruction in runtime queue once
-    //         for (auto dep_it = dep_uids.begin(); dep_it != dep_uids.end();) {
-    //             // Check if any of the instruction to be scheduled dependencies match the current instruction from queue
-    //             if (queued_inst->getUID() == *dep_it) {
-    //                 // If dependency found, create two way link
-    //                 inst->addRuntimeDependency(queued_inst);
-    //                 queued_inst->addRuntimeUser(inst);
-    //                 dep_it = dep_uids.erase(dep_it);
-    //             } else {
-    //                 dep_it++;
-    //             }
-    //         }
-    //         if (dep_uids.empty()) break;
-    //     }
-    // }
-    // Check the memory write queue
-    for (auto dep_it = dep_uids.begin(); dep_it != dep_uids.end();) {
-        auto queue_iter = writeQueue.find(*dep_it);
-        if (queue_iter != writeQueue.end()) {
-            auto queued_inst = queue_iter->second;
-            inst->addRuntimeDependency(queued_inst);
-            queued_inst->addRuntimeUser(inst);
-            dep_it = dep_uids.erase(dep_it);
+    for (auto dep_uid : dep_uids) {
+        auto &producer = lastProducer.at(dep_uid);
+        if (producer && !producer->isCommitted()) {
+            // If dependency is still in flight, create two way link
+            if (inst->addRuntimeDependency(producer)) producer->addRuntimeUser(inst);
         } else {
-            dep_it++;
-        }
-    }
-
-    // if (!dep_uids.empty()) {
-    //     // Check the memory write queue
-    //     // for (auto queued_write : writeQueue) {
-    //     for (auto wq_it = writeQueue.begin(); wq_it != writeQueue.end(); wq_it++) {
-    //         auto queued_write = *wq_it;
-    //         auto queued_inst = queued_write.second;
-    //         // Look at each instruction in runtime queue once
-    //         for (auto dep_it = dep_uids.begin(); dep_it != dep_uids.end();) {
-    //             // Check if any of the instruction to be scheduled dependencies match the current instruction from queue
-    //             if (queued_inst->getUID() == *dep_it) {
-    //                 // If dependency found, create two way link
-    //                 inst->addRuntimeDependency(queued_inst);
-    //                 queued_inst->addRuntimeUser(inst);
-    //                 dep_it = dep_uids.erase(dep_it);
-    //             } else {
-    //                 dep_it++;
-    //             }
-    //         }
-    //         if (dep_uids.empty()) break;
-    //     }
-    // }
-
-    // Fetch values for resolved dependencies, static elements, and immediate values
-    if (!dep_uids.empty()) {
-        for (auto resolved : dep_uids) {
-            // If this dependency exists, then lock value into operand
-            inst->setOperandValue(resolved);
+            // Committed producers, static elements, and immediate values
+            // can be locked into the operand now
+            inst->setOperandValue(dep_uid, producer ? producer->getReg() : nullptr);
         }
     }
+    lastProducer.at(inst->getUID()) = inst;
 }
 
 void
@@ -430,6 +664,25 @@ LLVMInterface::dumpModule(llvm::Module *M) {
 
 
 
+// Integer operand of a loop metadata entry. Entries without an operand read
+// as 1 and missing entries as -1
+static int64_t
+loopMetadataValue(llvm::Loop *loop, llvm::StringRef key) {
+    llvm::MDNode *loopID = loop->getLoopID();
+    if (!loopID) return -1;
+    for (unsigned i = 1; i < loopID->getNumOperands(); i++) {
+        auto *node = llvm::dyn_cast<llvm::MDNode>(loopID->getOperand(i));
+        if (!node || (node->getNumOperands() == 0)) continue;
+        auto *name = llvm::dyn_cast<llvm::MDString>(node->getOperand(0));
+        if (!name || (name->getString() != key)) continue;
+        if (node->getNumOperands() < 2) return 1;
+        if (auto *val = llvm::mdconst::dyn_extract<llvm::ConstantInt>(node->getOperand(1)))
+            return val->getSExtValue();
+        return -1;
+    }
+    return -1;
+}
+
 void
 LLVMInterface::constructStaticGraph() {
 /*********************************************************************************************
@@ -442,14 +695,13 @@ LLVMInterface::constructStaticGraph() {
     // if (DTRACE(Trace)) DPRINTF(Runtime, "Trace: %s \n", __PRETTY_FUNCTION__);
     if (dbg) DPRINTF(LLVMInterface, "Constructing Static Dependency Graph\n");
 
-    llvm::StringRef file = filename;
     std::unique_ptr<llvm::LLVMContext> context(new llvm::LLVMContext());
     std::unique_ptr<llvm::SMDiagnostic> error(new llvm::SMDiagnostic());
     std::unique_ptr<llvm::Module> m;
     std::unique_ptr<llvm::DominatorTree> dt(new llvm::DominatorTree());
     std::unique_ptr<llvm::LoopInfoBase<llvm::BasicBlock, llvm::Loop>> loopInfo(new llvm::LoopInfoBase<llvm::BasicBlock, llvm::Loop>());
 
-    m = llvm::parseIRFile(file, *error, *context);
+    m = loadModule(*context, *error);
     if(!m) panic("Error reading Module");
 
     // Construct the LLVM::Value to SALAM::Value map
@@ -495,6 +747,7 @@ LLVMInterface::constructStaticGraph() {
             for (auto inst_iter = bb.begin(); inst_iter != bb.end(); inst_iter++) {
                 llvm::Instruction &inst = *inst_iter;
                 std::shared_ptr<SALAM::Instruction> sinst = createInstruction(&inst, valueID);
+                sinst->linkFunctionalUnit(hw);
                 values.push_back(sinst);
                 vmap.insert(SALAM::irvmaptype(&inst, sinst));
                 valueID++;
@@ -524,9 +777,53 @@ LLVMInterface::constructStaticGraph() {
     }
     if (functions.size() == 1) functions.front()->setTop(true);
 
+    // Apply the configured concurrent instance limits
+    limitedFunctions.assign(instanceLimits.size(), nullptr);
+    for (size_t i = 0; i < instanceLimits.size(); i++) {
+        for (auto sfunc : functions) {
+            if (sfunc->getName() == instanceLimits.at(i).first) {
+                sfunc->setInstanceLimit(instanceLimits.at(i).second);
+                limitedFunctions.at(i) = sfunc;
+            }
+        }
+        if (!limitedFunctions.at(i))
+            warn("Instance limit set for unknown function %s\n", instanceLimits.at(i).first);
+    }
+    // Lay out the register file of each function
+    for (auto sfunc : functions) sfunc->assignRegisterSlots();
+
+    // Compile the pure dataflow of each basic block
+    if (jitCompute) {
+    #if USE_LLVM_AP_VALUES
+        warn("Block JIT needs raw register values, evaluating %s by interpretation\n", name());
+    #else
+        auto jitStart = std::chrono::high_resolution_clock::now();
+        blockJIT = SALAM::BlockJIT::create();
+        if (blockJIT) {
+            for (auto &func : *m) {
+                for (auto &bb : func) {
+                    for (auto &compiled : blockJIT->compileBlock(&bb)) {
+                        auto sinst = std::dynamic_pointer_cast<SALAM::Instruction>(vmap.find(compiled.first)->second);
+                        sinst->setJITKernel(compiled.second);
+                    }
+                }
+            }
+            stats.jitBlocks += blockJIT->compiledBlocks();
+            stats.jitKernels += blockJIT->compiledKernels();
+        }
+        std::chrono::duration<float> jitTime = std::chrono::high_resolution_clock::now() - jitStart;
+        stats.jitCompileSeconds += jitTime.count();
+    #endif
+    }
+
     // Detect Loop Latches
+    std::set<std::string> configuredLoops;
+    std::set<std::string> foundLoops;
+    sampledLoops.clear();
     for (auto func_iter = m->begin(); func_iter != m->end(); func_iter++) {
         llvm::Function &func = *func_iter;
+        // Intrinsic declarations have no body to analyze
+        if (func.isDeclaration()) continue;
         dt->recalculate(func);
         loopInfo->releaseMemory();
         loopInfo->analyze(*dt);
@@ -543,11 +840,371 @@ LLVMInterface::constructStaticGraph() {
                 }
             }
         }
+        // Pipelined and sampled loops, nested ones included
+        for (auto loop : loopInfo->getLoopsInPreorder()) {
+            llvm::BasicBlock *exBB = loop->getExitingBlock();
+            std::string loopName = func.getName().str() + ":" + loop->getHeader()->getName().str();
+            // Sampled loops leave through a single conditional branch, whose
+            // successor inside the loop starts the next iteration
+            bool sampled = (samplingPeriod > 0) &&
+                (samplingConfig.empty() ? loop->getSubLoops().empty()
+                                        : (samplingConfig.find(loopName) != samplingConfig.end()));
+            if (sampled) {
+                foundLoops.insert(loopName);
+                auto br = exBB ? llvm::dyn_cast<llvm::BranchInst>(exBB->getTerminator()) : nullptr;
+                if (br && br->isConditional()) {
+                    llvm::BasicBlock *body = br->getSuccessor(loop->contains(br->getSuccessor(0)) ? 0 : 1);
+                    auto bodyIt = vmap.find(body);
+                    auto brIt = vmap.find(br);
+                    if ((bodyIt != vmap.end()) && (brIt != vmap.end())) {
+                        LoopSample sample;
+                        sample.name = loopName;
+                        sample.body = bodyIt->second->getUID();
+                        sampledLoops[brIt->second->getUID()] = sample;
+                        DPRINTF(LLVMParse, "Sampling loop %s every %d iterations\n", loopName, samplingPeriod);
+                    }
+                } else if (!samplingConfig.empty()) {
+                    warn("Sampled loop %s has no single exiting branch\n", loopName);
+                }
+            }
+            if (!exBB) continue;
+            int64_t ii = loopMetadataValue(loop, "llvm.loop.pipeline.initiationinterval");
+            int64_t overlap = loopMetadataValue(loop, "salam.loop.pipeline.overlap");
+            if (loopMetadataValue(loop, "llvm.loop.pipeline.disable") > 0) ii = -1;
+            auto config = pipelineConfig.find(loopName);
+            if (config != pipelineConfig.end()) {
+                ii = config->second.first;
+                overlap = config->second.second;
+                configuredLoops.insert(loopName);
+            }
+            if (ii <= 0) continue;
+            auto mapIt = vmap.find(exBB->getTerminator());
+            if (mapIt == vmap.end()) continue;
+            auto sBr = std::dynamic_pointer_cast<SALAM::Br>(mapIt->second);
+            if (!sBr) continue;
+            sBr->setLatching(true);
+            LoopPipeline pipeline;
+            pipeline.name = loopName;
+            pipeline.targetII = ii;
+            pipeline.maxOverlap = (overlap > 0) ? overlap : pipelineMaxOverlap;
+            pipelinedLoops[sBr->getUID()] = pipeline;
+            DPRINTF(LLVMParse, "Pipelining loop %s, II:%d, Overlap:%d\n",
+                loopName, pipeline.targetII, pipeline.maxOverlap);
+        }
+    }
+    for (auto &config : pipelineConfig) {
+        if (configuredLoops.find(config.first) == configuredLoops.end())
+            warn("Pipelined loop %s not found\n", config.first);
+    }
+    if (samplingPeriod > 0) {
+        for (auto &config : samplingConfig) {
+            if (foundLoops.find(config) == foundLoops.end())
+                warn("Sampled loop %s not found\n", config);
+        }
     }
+    instancePools.resize(values.size());
     auto parseStop = std::chrono::high_resolution_clock::now();
     setupTime = parseStop - parseStart;
 }
 
+std::unique_ptr<llvm::Module>
+LLVMInterface::loadModule(llvm::LLVMContext &context, llvm::SMDiagnostic &error) {
+/*********************************************************************************************
+ Load the LLVM Module
+
+ Parsing textual IR dominates setup for large designs. When a cache directory is given the
+ module is stored there as bitcode, named by a hash of the IR text, and later runs on the same
+ IR read the bitcode instead.
+*********************************************************************************************/
+    if (irCacheDir.empty()) return llvm::parseIRFile(filename, error, context);
+
+    auto irBuffer = llvm::MemoryBuffer::getFile(filename);
+    if (!irBuffer) {
+        warn("Could not open %s: %s\n", filename, irBuffer.getError().message());
+        return llvm::parseIRFile(filename, error, context);
+    }
+    std::stringstream hash;
+    hash << std::hex << std::setw(16) << std::setfill('0')
+         << llvm::xxHash64((*irBuffer)->getBuffer());
+    std::string cacheFile = irCacheDir + "/" + llvm::sys::path::stem(filename).str()
+                          + "." + hash.str() + ".bc";
+
+    if (llvm::sys::fs::exists(cacheFile)) {
+        auto m = llvm::parseIRFile(cacheFile, error, context);
+        if (m) {
+            if (dbg) DPRINTF(LLVMInterface, "Loaded cached IR from %s\n", cacheFile);
+            irCacheHit = true;
+            return m;
+        }
+        warn("Discarding unreadable IR cache entry %s\n", cacheFile);
+    }
+
+    auto m = llvm::parseIR((*irBuffer)->getMemBufferRef(), error, context);
+    if (!m) return m;
+    // Write to a uniquely named temporary first so concurrent runs, and
+    // accelerators loading the same IR on other threads, never see a partial file
+    std::error_code ec = llvm::sys::fs::create_directories(irCacheDir);
+    llvm::SmallString<128> tmpFile;
+    if (!ec) {
+        int fd;
+        ec = llvm::sys::fs::createUniqueFile(cacheFile + ".%%%%%%%%.tmp", fd, tmpFile);
+        if (!ec) {
+            llvm::raw_fd_ostream out(fd, true);
+            llvm::WriteBitcodeToFile(*m, out);
+            out.close();
+            ec = out.has_error() ? out.error() : llvm::sys::fs::rename(tmpFile, cacheFile);
+        }
+    }
+    if (ec) {
+        warn("Could not write IR cache entry %s: %s\n", cacheFile, ec.message());
+        if (!tmpFile.empty()) llvm::sys::fs::remove(tmpFile);
+    } else if (dbg) {
+        DPRINTF(LLVMInterface, "Cached IR as %s\n", cacheFile);
+    }
+    return m;
+}
+
+bool
+LLVMInterface::ActiveFunction::orderingStall(std::shared_ptr<SALAM::Instruction> inst) {
+    auto seq = inst->getSequence();
+    switch (memoryOrder) {
+        case STRICT:
+            return olderUnissued(unissuedLoads, seq) || olderUnissued(unissuedStores, seq);
+        case TSO:
+            if (!inst->isLoad()) return olderUnissued(unissuedLoads, seq) || olderUnissued(unissuedStores, seq);
+            return olderUnissued(unissuedLoads, seq) || olderStoreAliases(inst);
+        default:
+            return false;
+    }
+}
+
+bool
+LLVMInterface::ActiveFunction::olderStoreAliases(std::shared_ptr<SALAM::Instruction> loadInst) {
+    // Loads may pass older unissued stores, but not ones to the same bytes.
+    // Older stores are placed by address as their pointers resolve, the
+    // first one that cannot be placed may alias anything. Bulk intrinsics
+    // and atomics are never placed
+    auto seq = loadInst->getSequence();
+    for (auto it = unplacedStores.begin(); (it != unplacedStores.end()) && (*it < seq);) {
+        auto store = reservation.at(*it);
+        if (!store->isStore()) return true;
+        auto &operands = *store->getOperands();
+        for (auto pending : store->getDynamicDependencies()) {
+            if (pending == operands[1].getUID()) return true;
+        }
+        placedStores.track(*it, {store->getPtrOperandValue(1), operands[0].getSizeInBytes(), store, nullptr, *it});
+        it = unplacedStores.erase(it);
+    }
+    Addr loadAddr = loadInst->getPtrOperandValue(0);
+    size_t loadSize = loadInst->getSizeInBytes();
+    return placedStores.youngestOverlap(loadAddr, loadSize, seq) != nullptr;
+}
+
+void
+LLVMInterface::ActiveFunction::forwardStore(std::shared_ptr<SALAM::Instruction> loadInst, const MemAccess &store) {
+    // The store buffer holds the data until the write commits
+    Addr loadAddr = loadInst->getPtrOperandValue(0);
+    if (dbg) DPRINTFS(Runtime, owner,  "\t\t  | Forwarding store UID[%i] to load UID[%i] at 0x%lx\n",
+        store.inst->getUID(), loadInst->getUID(), loadAddr);
+    loadInst->setRegisterValue(store.req->getBuffer() + (loadAddr - store.addr));
+    loadInst->compute();
+    loadInst->commit();
+}
+
+uint64_t
+LLVMInterface::ActiveFunction::oldestInFlight(uint64_t skip) {
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    for (auto &entry : reservation) {
+        if (entry.first != skip) {
+            oldest = entry.first;
+            break;
+        }
+    }
+    if (!inFlightSequences.empty()) oldest = std::min(oldest, *inFlightSequences.begin());
+    return oldest;
+}
+
+bool
+LLVMInterface::ActiveFunction::latchStall(std::shared_ptr<SALAM::Instruction> inst) {
+    auto loop = owner->pipelinedLoops.find(inst->getUID());
+    if (loop == owner->pipelinedLoops.end()) {
+        // Loops that are not pipelined drain before the next iteration is scheduled
+        return (reservation.size() > 1) || !queuesClear();
+    }
+    auto &pipeline = loop->second;
+    auto &state = loopStates[inst->getUID()];
+    if ((state.lastLaunch >= 0) && ((unsigned)(owner->cycle - state.lastLaunch) < pipeline.targetII)) {
+        pipeline.iiStalls++;
+        owner->stats.pipelineIIStalls++;
+        return true;
+    }
+    // Retire iterations that have nothing left in flight. The iteration closed
+    // by this branch is counted while any older instruction is outstanding
+    uint64_t seq = inst->getSequence();
+    uint64_t oldest = oldestInFlight(seq);
+    while (!state.openIterations.empty() && (state.openIterations.front() < oldest))
+        state.openIterations.pop_front();
+    size_t overlapped = state.openIterations.size() + 1;
+    if (oldest < seq) overlapped++;
+    if (overlapped > pipeline.maxOverlap) {
+        pipeline.overlapStalls++;
+        owner->stats.pipelineOverlapStalls++;
+        return true;
+    }
+    return false;
+}
+
+void
+LLVMInterface::ActiveFunction::recordLatch(std::shared_ptr<SALAM::Instruction> inst) {
+    auto loop = owner->pipelinedLoops.find(inst->getUID());
+    if (loop == owner->pipelinedLoops.end()) return;
+    auto &pipeline = loop->second;
+    auto &state = loopStates[inst->getUID()];
+    if (inst->isLatchingBrExiting()) {
+        if (state.lastLaunch >= 0) {
+            pipeline.intervalCycles += owner->cycle - state.lastLaunch;
+            pipeline.intervals++;
+        }
+        state.lastLaunch = owner->cycle;
+        state.openIterations.push_back(inst->getSequence());
+        pipeline.iterations++;
+        owner->stats.pipelinedIterations++;
+        if (dbg) DPRINTFS(Runtime, owner, "\t\t  | Pipelined iteration %d of %s\n",
+            pipeline.iterations, pipeline.name);
+    } else {
+        // Leaving the loop, the initiation interval restarts on the next entry
+        state.lastLaunch = -1;
+    }
+}
+
+/*********************************************************************************************
+ Loop Sampling
+
+ Sampled loops alternate between detailed and functional execution every sampling period.
+ The first iterations of a period warm the datapath and memory state, the following ones form
+ a sampling unit whose cycles per iteration are measured, and the rest are fast-forwarded.
+ Fast-forwarding waits for the function to drain, then executes whole basic blocks against
+ memory through functional accesses and retires their instances, so the timing model resumes
+ with every operand already committed.
+*********************************************************************************************/
+bool
+LLVMInterface::ActiveFunction::canFastForward() {
+    // Other active functions would keep running without the skipped iterations
+    return (owner->samplingPeriod > owner->sampleWarmup + owner->sampleSize) &&
+           (owner->activeFunctions.size() == 1);
+}
+
+bool
+LLVMInterface::ActiveFunction::samplingStall(std::shared_ptr<SALAM::Instruction> inst) {
+    auto loop = owner->sampledLoops.find(inst->getUID());
+    if (loop == owner->sampledLoops.end()) return false;
+    auto &state = sampleStates[inst->getUID()];
+    // Only the branch closing a sampling unit waits, and only to fast-forward
+    if (state.phase + 1 != owner->sampleWarmup + owner->sampleSize) return false;
+    if (inst->getTarget()->getUID() != loop->second.body) return false;
+    // The unit ends when its last iteration is ready to branch, the drain
+    // below is not part of the measurement
+    if (state.unitEnd < 0) state.unitEnd = owner->cycle;
+    if (!canFastForward()) return false;
+    return (reservation.size() > 1) || !queuesClear();
+}
+
+std::shared_ptr<SALAM::BasicBlock>
+LLVMInterface::ActiveFunction::sampleIteration(std::shared_ptr<SALAM::Instruction> inst,
+                                               std::shared_ptr<SALAM::BasicBlock> nextBB) {
+    auto loop = owner->sampledLoops.find(inst->getUID());
+    if (loop == owner->sampledLoops.end()) return nextBB;
+    auto &sample = loop->second;
+    auto &state = sampleStates[inst->getUID()];
+    if (nextBB->getUID() != sample.body) {
+        // Leaving the loop discards a partial unit
+        state = SampleState();
+        return nextBB;
+    }
+    state.phase++;
+    if (state.phase == owner->sampleWarmup) state.unitStart = owner->cycle;
+    if (state.phase < owner->sampleWarmup + owner->sampleSize) return nextBB;
+    int unitEnd = (state.unitEnd >= 0) ? state.unitEnd : owner->cycle;
+    double cpi = (double)(unitEnd - state.unitStart) / owner->sampleSize;
+    sample.units++;
+    sample.sum += cpi;
+    sample.sumSq += cpi * cpi;
+    sample.measuredIterations += owner->sampleSize;
+    owner->stats.sampledUnits++;
+    owner->stats.sampledIterations += owner->sampleSize;
+    state = SampleState();
+    if (!canFastForward() || (reservation.size() > 1) || !queuesClear()) return nextBB;
+    uint64_t iterations = owner->samplingPeriod - owner->sampleWarmup - owner->sampleSize;
+    return fastForward(inst, nextBB, iterations);
+}
+
+std::shared_ptr<SALAM::BasicBlock>
+LLVMInterface::ActiveFunction::fastForward(std::shared_ptr<SALAM::Instruction> branch,
+                                           std::shared_ptr<SALAM::BasicBlock> bb,
+                                           uint64_t iterations) {
+    // Runs the loop functionally from bb until its exiting branch has started
+    // the given number of iterations or left the loop, and returns the block
+    // timing resumes at. previousBB follows the executed blocks for its phis
+    auto &sample = owner->sampledLoops.at(branch->getUID());
+    if (dbg) DPRINTFS(LLVMInterface, owner, "Fast-forwarding %d iterations of %s\n", iterations, sample.name);
+    if (owner->functionalInstances.empty()) owner->functionalInstances.resize(owner->values.size());
+    bool concurrent = func->isConcurrent();
+    // Producers have all committed, so operands lock in their values at once
+    auto lockOperands = [this](std::shared_ptr<SALAM::Instruction> inst) {
+        for (auto dep_uid : inst->runtimeInitialize(registers.data())) {
+            auto &producer = lastProducer.at(dep_uid);
+            inst->setOperandValue(dep_uid, producer ? producer->getReg() : nullptr);
+        }
+    };
+    uint64_t skipped = 0;
+    uint64_t executed = 0;
+    std::vector<std::shared_ptr<SALAM::Instruction>> instances;
+    while (true) {
+        auto instructions = bb->Instructions();
+        // Returns signal the caller, leave them to the timing model
+        if (instructions->back()->isReturn()) break;
+        instances.clear();
+        for (auto inst : *instructions) instances.push_back(owner->acquireInstance(inst, concurrent));
+        // Phis take their incoming values as of block entry
+        size_t phis = 0;
+        for (; (phis < instances.size()) && instances.at(phis)->isPhi(); phis++) {
+            auto phi = std::static_pointer_cast<SALAM::Phi>(instances.at(phis));
+            phi->setPrevBB(previousBB);
+            lockOperands(phi);
+        }
+        std::shared_ptr<SALAM::BasicBlock> nextBB = nullptr;
+        for (size_t i = 0; i < instances.size(); i++) {
+            auto inst = instances.at(i);
+            if (i >= phis) lockOperands(inst);
+            lastProducer.at(inst->getUID()) = inst;
+            executed++;
+            if (inst->isTerminator()) {
+                nextBB = inst->getTarget();
+            } else if (inst->isLoad() || inst->isStore() || inst->isAtomic() || inst->isMemoryIntrinsic()) {
+                owner->executeMemoryFunctional(inst);
+            } else if (inst->isCall() && !std::static_pointer_cast<SALAM::Call>(inst)->isIntrinsic()) {
+                auto calleeValue = std::static_pointer_cast<SALAM::Call>(inst)->getCalleeValue();
+                auto callee = std::dynamic_pointer_cast<SALAM::Function>(calleeValue);
+                assert(callee);
+                owner->executeFunctional(callee, inst);
+            } else {
+                inst->execute();
+            }
+            inst->retire();
+        }
+        previousBB = bb;
+        bb = nextBB;
+        if (instances.back()->getUID() == branch->getUID()) {
+            if (bb->getUID() != sample.body) break;
+            if (++skipped == iterations) break;
+        }
+    }
+    sample.skippedIterations += skipped;
+    owner->stats.fastForwardedIterations += skipped;
+    owner->stats.fastForwardedInsts += executed;
+    return bb;
+}
+
 void
 LLVMInterface::launchRead(MemoryRequest * memReq, ActiveFunction * func) {
     globalReadQueue.insert({memReq, func});
@@ -562,8 +1219,9 @@ LLVMInterface::ActiveFunction::launchRead(std::shared_ptr<SALAM::Instruction> re
     } else {
         auto memReq = (readInst)->createMemoryRequest();
         auto rd_uid = readInst->getUID();
-        readQueue.insert({rd_uid, (readInst)});
+        enqueue(readQueue, rd_uid, readInst);
         readQueueMap.insert({memReq, rd_uid});
+        trackAccess(inflightLoads, memReq->getAddress(), memReq->getLength(), readInst, memReq);
         owner->launchRead(memReq, this);
     }
 }
@@ -577,13 +1235,78 @@ LLVMInterface::launchWrite(MemoryRequest * memReq, ActiveFunction * func) {
 void
 LLVMInterface::ActiveFunction::launchWrite(std::shared_ptr<SALAM::Instruction> writeInst) {
     auto memReq = (writeInst)->createMemoryRequest();
-    trackWrite(memReq->getAddress(), writeInst);
+    trackAccess(inflightStores, memReq->getAddress(), memReq->getLength(), writeInst, memReq);
     auto wr_uid = writeInst->getUID();
-    writeQueue.insert({wr_uid, (writeInst)});
+    enqueue(writeQueue, wr_uid, writeInst);
     writeQueueMap.insert({memReq, wr_uid});
     owner->launchWrite(memReq, this);
 }
 
+void
+LLVMInterface::ActiveFunction::launchAtomic(std::shared_ptr<SALAM::Instruction> atomicInst) {
+    // The swap both reads and writes its location, so it is tracked as a
+    // load and a store until the response arrives
+    auto memReq = atomicInst->createMemoryRequest();
+    auto uid = atomicInst->getUID();
+    trackAccess(inflightLoads, memReq->getAddress(), memReq->getLength(), atomicInst, memReq);
+    trackAccess(inflightStores, memReq->getAddress(), memReq->getLength(), atomicInst, memReq);
+    enqueue(readQueue, uid, atomicInst);
+    readQueueMap.insert({memReq, uid});
+    atomicIssueCycle.insert({memReq, owner->cycle});
+    owner->stats.atomicOps++;
+    owner->launchRead(memReq, this);
+}
+
+bool
+LLVMInterface::ActiveFunction::burstHazard(std::shared_ptr<SALAM::Call> callInst) {
+    // Bursts wait for overlapping accesses to drain rather than sleeping on them
+    Addr dest = callInst->getBurstDestination();
+    size_t len = callInst->getBurstLength();
+    if (inflightLoads.youngestOverlap(dest, len) || inflightStores.youngestOverlap(dest, len))
+        return true;
+    if (callInst->getIntrinsic() == SALAM::IntrinsicKind::MemCopy)
+        return inflightStores.youngestOverlap(callInst->getBurstSource(), len) != nullptr;
+    return false;
+}
+
+void
+LLVMInterface::ActiveFunction::launchBurst(std::shared_ptr<SALAM::Call> callInst) {
+    size_t len = callInst->getBurstLength();
+    if (len == 0) {
+        callInst->commit();
+        return;
+    }
+    owner->stats.bursts++;
+    owner->stats.burstBytes += len;
+    auto uid = callInst->getUID();
+    auto memReq = callInst->createMemoryRequest();
+    if (callInst->getIntrinsic() == SALAM::IntrinsicKind::MemSet) {
+        trackAccess(inflightStores, memReq->getAddress(), len, callInst, memReq);
+        enqueue(writeQueue, uid, callInst);
+        writeQueueMap.insert({memReq, uid});
+        owner->launchWrite(memReq, this);
+    } else {
+        // The destination is claimed up front so younger accesses to it wait
+        // on the copy. It is tracked under the source read until the write
+        // request replaces it
+        trackAccess(inflightLoads, memReq->getAddress(), len, callInst, memReq);
+        trackAccess(inflightStores, callInst->getBurstDestination(), len, callInst, memReq);
+        enqueue(readQueue, uid, callInst);
+        readQueueMap.insert({memReq, uid});
+        owner->launchRead(memReq, this);
+    }
+}
+
+void
+LLVMInterface::ActiveFunction::continueBurst(std::shared_ptr<SALAM::Call> callInst, MemoryRequest * readReq) {
+    auto memReq = callInst->createWriteBurst(readReq->getBuffer());
+    inflightStores.rekey(readReq, memReq);
+    auto uid = callInst->getUID();
+    enqueue(writeQueue, uid, callInst);
+    writeQueueMap.insert({memReq, uid});
+    owner->launchWrite(memReq, this);
+}
+
 void
 LLVMInterface::readCommit(MemoryRequest * req) {
 /*********************************************************************************************
@@ -613,11 +1336,31 @@ LLVMInterface::ActiveFunction::readCommit(MemoryRequest * req) {
         if (queue_iter != readQueue.end()) {
             auto load_inst = queue_iter->second;
             uint8_t * readBuff = req->getBuffer();
-            load_inst->setRegisterValue(readBuff);
-            load_inst->compute();
-            if (dbg) DPRINTFS(Runtime, owner,  "Local Read Commit\n");
-            load_inst->commit();
-            readQueue.erase(queue_iter);
+            if (load_inst->isMemoryIntrinsic()) {
+                // The source of a bulk copy has arrived, stream it to the destination
+                continueBurst(std::static_pointer_cast<SALAM::Call>(load_inst), req);
+            } else if (load_inst->isAtomic()) {
+                // The response carries the value memory held before the update
+                load_inst->setAtomicResult(readBuff);
+                inflightStores.untrack(req);
+                auto issue = atomicIssueCycle.find(req);
+                if (issue != atomicIssueCycle.end()) {
+                    owner->stats.atomicLatency.sample(owner->cycle - issue->second);
+                    atomicIssueCycle.erase(issue);
+                }
+                if (!load_inst->launch()) enqueue(computeQueue, load_inst->getUID(), load_inst);
+                if (load_inst->isCmpXchg() &&
+                    !std::static_pointer_cast<SALAM::CmpXchg>(load_inst)->succeeded())
+                    owner->stats.casFailures++;
+                if (dbg) DPRINTFS(Runtime, owner,  "Local Atomic Commit\n");
+            } else {
+                load_inst->setRegisterValue(readBuff);
+                load_inst->compute();
+                if (dbg) DPRINTFS(Runtime, owner,  "Local Read Commit\n");
+                load_inst->commit();
+            }
+            inflightLoads.untrack(req);
+            dequeue(readQueue, queue_iter);
             readQueueMap.erase(map_iter);
         } else {
             panic("Could not find memory request in read queue for function %u!", func->getUID());
@@ -654,9 +1397,8 @@ LLVMInterface::ActiveFunction::writeCommit(MemoryRequest * req) {
         auto queue_iter = writeQueue.find(map_iter->second);
         if (queue_iter != writeQueue.end()) {
             queue_iter->second->commit();
-            Addr addressWritten = map_iter->first->getAddress();
-            untrackWrite(addressWritten);
-            writeQueue.erase(queue_iter);
+            inflightStores.untrack(req);
+            dequeue(writeQueue, queue_iter);
             writeQueueMap.erase(map_iter);
         } else {
             panic("Could not find memory request in write queue for function %u!", func->getUID());
@@ -682,8 +1424,50 @@ LLVMInterface::initialize() {
     queueProcessTime = std::chrono::seconds(0);
     computeTime = std::chrono::seconds(0);
     hwTime = std::chrono::seconds(0);
-    constructStaticGraph();
+    // The static graph and its JIT kernels are built by the first invocation
+    // and kept until the interface is destroyed. Later invocations only start
+    // the per-invocation loop records over
+    if (values.empty()) {
+        constructStaticGraph();
+    } else {
+        auto resetStart = std::chrono::high_resolution_clock::now();
+        for (auto &loop : pipelinedLoops) {
+            auto &pipeline = loop.second;
+            pipeline = LoopPipeline{pipeline.name, pipeline.targetII, pipeline.maxOverlap};
+        }
+        for (auto &loop : sampledLoops) {
+            auto &sample = loop.second;
+            sample = LoopSample{sample.name, sample.body};
+        }
+        setupTime = std::chrono::high_resolution_clock::now() - resetStart;
+    }
+    if (functionalMode && (functionalLimit >= 0) && (invocations >= (uint64_t)functionalLimit)) {
+        inform("%s: switching to timing after %d functional invocations\n", name(), invocations);
+        functionalMode = false;
+    }
+    functionalRun = functionalMode;
+    invocations++;
     timeStart = std::chrono::high_resolution_clock::now();
+    if (functionalRun) {
+        if (dbg) DPRINTF(LLVMInterface, "Executing invocation %d functionally\n", invocations);
+        functionalInsts = 0;
+        functionalInstances.resize(values.size());
+        for (auto func : functions) {
+            if (func->isTop()) {
+                executeFunctional(func, nullptr);
+                break;
+            }
+        }
+        functionalTime = std::chrono::high_resolution_clock::now() - timeStart;
+        stats.functionalInvocations++;
+        stats.functionalInsts += functionalInsts;
+        stats.functionalHostSeconds += functionalTime.count();
+        running = true;
+        cycle = 0;
+        stalls = 0;
+        schedule(tickEvent, curTick() + clock_period);
+        return;
+    }
     if (dbg) DPRINTF(LLVMInterface, "================================================================\n");
     launchTopFunction();
     
@@ -730,6 +1514,13 @@ LLVMInterface::startup() {
 *********************************************************************************************/
     // if (DTRACE(Trace)) DPRINTF(Runtime, "Trace: %s \n", __PRETTY_FUNCTION__);
     comm->registerCompUnit(this);
+    if (hw->hw_statistics->use_cycle_tracking()) {
+        // Cycle trace records carry the in-use count of each unit in list order
+        std::vector<std::string> fu_aliases;
+        for (auto fu : hw->functional_units->functional_unit_list)
+            fu_aliases.push_back(fu->get_alias());
+        hw->hw_statistics->startCycleTrace(fu_aliases);
+    }
 }
 
 // LLVMInterface*
@@ -747,12 +1538,37 @@ LLVMInterface::finalize() {
     // Simulation Times
     simStop = std::chrono::high_resolution_clock::now();
     simTotal = simStop - timeStart;
-    printResults();
-    functions.clear();
-    values.clear();
+    if (!functionalRun && (samplingPeriod > 0)) extrapolateSampling();
+    if (functionalRun) printFunctionalResults();
+    else printResults();
     comm->finish();
 }
 
+double
+LLVMInterface::LoopSample::variance() const {
+    if (units < 2) return 0;
+    return std::max((sumSq - sum * sum / units) / (units - 1), 0.0);
+}
+
+void
+LLVMInterface::extrapolateSampling() {
+    // Fast-forwarded iterations took no simulated cycles. Each loop costs them
+    // at its mean rate, with the standard error of the mean scaled by the
+    // skipped iterations. Loops are sampled independently, so variances add
+    double variance = 0;
+    extrapolatedCycles = cycle;
+    for (auto &loop : sampledLoops) {
+        auto &sample = loop.second;
+        if (sample.skippedIterations == 0) continue;
+        double skipped = sample.skippedIterations;
+        extrapolatedCycles += skipped * sample.mean();
+        variance += skipped * skipped * sample.variance() / sample.units;
+    }
+    extrapolationError = 1.96 * std::sqrt(variance);
+    stats.extrapolatedCycles += extrapolatedCycles;
+    stats.extrapolationError += extrapolationError;
+}
+
 void
 LLVMInterface::printResults() {
 
@@ -893,6 +1709,8 @@ LLVMInterface::printResults() {
 
     std::cout << "   ========= Performance Analysis =============" << std::endl;
     std::cout << "   Setup Time:                      " << setupHours.count() << "h " << setupMins.count() << "m " << setupSecs.count() << "s " << setupMS.count() << "ms " << setupUS.count() << "us" << std::endl;
+    if (!irCacheDir.empty())
+        std::cout << "        IR Cache:                   " << (irCacheHit ? "hit" : "miss") << std::endl;
     std::cout << "   Simulation Time (Total):         " << totalHours.count() << "h " << totalMins.count() << "m " << totalSecs.count() << "s " << totalMS.count() << "ms" << std::endl;
     std::cout << "   Simulation Time (Active):        " << simHours.count() << "h " << simMins.count() << "m " << simSecs.count() << "s " << simMS.count() << "ms" << std::endl;
     std::cout << "        Queue Processing Time:      " << queueHours.count() << "h " << queueMins.count() << "m " << queueSecs.count() << "s " << queueMS.count() << "ms" << std::endl;
@@ -903,6 +1721,53 @@ LLVMInterface::printResults() {
     std::cout << "   Runtime:                         " << (cycle*cycle_time*(1e-3)) << " us" << std::endl;
     std::cout << "   Stalls:                          " << stalls << " cycles" << std::endl;
     std::cout << "   Executed Nodes:                  " << (cycle-stalls-1) << " cycles" << std::endl;
+    std::cout << "   Instances Allocated:             " << stats.instancesAllocated.value() << std::endl;
+    std::cout << "   Instances Recycled:              " << stats.instancesRecycled.value() << std::endl;
+    for (auto &loop : pipelinedLoops) {
+        auto &pipeline = loop.second;
+        std::cout << "   Pipelined Loop:                  " << pipeline.name << std::endl;
+        std::cout << "        Target II:                  " << pipeline.targetII << std::endl;
+        std::cout << "        Achieved II:                ";
+        if (pipeline.intervals > 0)
+            std::cout << ((double)pipeline.intervalCycles / pipeline.intervals) << std::endl;
+        else
+            std::cout << "-" << std::endl;
+        std::cout << "        Max Overlap:                " << pipeline.maxOverlap << std::endl;
+        std::cout << "        Iterations:                 " << pipeline.iterations << std::endl;
+        std::cout << "        II Stalls:                  " << pipeline.iiStalls << std::endl;
+        std::cout << "        Overlap Stalls:             " << pipeline.overlapStalls << std::endl;
+    }
+    for (auto &loop : sampledLoops) {
+        auto &sample = loop.second;
+        std::cout << "   Sampled Loop:                    " << sample.name << std::endl;
+        std::cout << "        Sampling Units:             " << sample.units << std::endl;
+        std::cout << "        Cycles Per Iteration:       ";
+        if (sample.units > 0)
+            std::cout << sample.mean() << " +/- " << (1.96 * std::sqrt(sample.variance() / sample.units)) << std::endl;
+        else
+            std::cout << "-" << std::endl;
+        std::cout << "        Measured Iterations:        " << sample.measuredIterations << std::endl;
+        std::cout << "        Fast-Forwarded Iterations:  " << sample.skippedIterations << std::endl;
+    }
+    if (samplingPeriod > 0)
+        std::cout << "   Extrapolated Runtime:            " << extrapolatedCycles << " +/- " << extrapolationError << " cycles (95% confidence)" << std::endl;
+    std::cout << std::endl;
+}
+
+void
+LLVMInterface::printFunctionalResults() {
+    float seconds = functionalTime.count();
+    std::cout << "********************************************************************************" << std::endl;
+    std::cout << name() << std::endl;
+    std::cout << "   ========= Functional Execution =============" << std::endl;
+    std::cout << "   Invocation:                      " << invocations << std::endl;
+    std::cout << "   Executed Instructions:           " << functionalInsts << std::endl;
+    std::cout << "   Execution Time:                  " << (seconds * 1e3) << "ms" << std::endl;
+    std::cout << "   Instructions Per Second:         ";
+    if (seconds > 0)
+        std::cout << (functionalInsts / seconds) << std::endl;
+    else
+        std::cout << "-" << std::endl;
     std::cout << std::endl;
 }
 
@@ -944,9 +1809,20 @@ LLVMInterface::launchFunction(std::shared_ptr<SALAM::Function> callee,
     // if (DTRACE(Trace)) DPRINTF(Runtime, "Trace: %s \n", __PRETTY_FUNCTION__);
     // Add the callee to our list of active functions
     activeFunctions.push_back(ActiveFunction(this, callee, caller));
+    stats.functionLaunches++;
+    int limited = limitedFunctionIndex(callee);
+    if (limited >= 0) stats.instanceLaunches[limited]++;
     activeFunctions.back().launch();
 }
 
+int
+LLVMInterface::limitedFunctionIndex(std::shared_ptr<SALAM::Function> func) {
+    for (size_t i = 0; i < limitedFunctions.size(); i++) {
+        if (limitedFunctions.at(i) == func) return i;
+    }
+    return -1;
+}
+
 void
 LLVMInterface::launchTopFunction() {
     // if (DTRACE(Trace)) DPRINTF(Runtime, "Trace: %s \n", __PRETTY_FUNCTION__);
@@ -961,19 +1837,13 @@ LLVMInterface::launchTopFunction() {
     panic("No function marked as top-level. Set the top_name parameter for your LLVMInterface to the name of the top-level function\n");
 }
 
-void LLVMInterface::ActiveFunction::launch() {
-    // if (DTRACE(Trace)) if (dbg) DPRINTFS(Runtime, owner,  "Trace: %s \n", __PRETTY_FUNCTION__);
-    if (dbg) DPRINTFS(LLVMInterface, owner, "Launching Function: %s\n", func->getIRStub());
-    // func->value_dump();
-    // Fetch the arguments
+void
+LLVMInterface::loadArguments(std::shared_ptr<SALAM::Function> func,
+                             std::shared_ptr<SALAM::Instruction> caller) {
     std::vector<std::shared_ptr<SALAM::Value>> funcArgs = *(func->getArguments());
     if (func->isTop()) {
         // We need to fetch argument values from the memory mapped registers
-        if (dbg) DPRINTFS(LLVMInterface, owner, "Connecting CommInterface\n");
-        CommInterface * comm = owner->getCommInterface();
-        if (dbg) DPRINTFS(LLVMInterface, owner, "Connecting HWInterface\n");
-        hw = owner->getHWInterface();
-
+        if (dbg) DPRINTF(LLVMInterface, "Connecting CommInterface\n");
         unsigned argOffset = 0;
         for (auto arg : funcArgs) {
             uint64_t argSizeInBytes = arg->getSizeInBytes();
@@ -984,11 +1854,145 @@ void LLVMInterface::ActiveFunction::launch() {
     } else {
         // We need to fetch argument values from the calling function
         //std::deque<SALAM::Operand> callerArgs = *caller->getOperands();
-        std::vector<SALAM::Operand> callerArgs = *caller->getOperands();
+        auto &callerArgs = *caller->getOperands();
         if (funcArgs.size() != callerArgs.size())
             panic("Function expects %d args. Got %d args.", funcArgs.size(), callerArgs.size());
         for (auto i = 0; i < callerArgs.size(); i++) {
-            funcArgs.at(i)->setRegisterValue(callerArgs.at(i).getOpRegister());
+            funcArgs.at(i)->setRegisterValue(callerArgs.at(i).getLockedData());
+        }
+    }
+}
+
+/*********************************************************************************************
+ Functional Execution
+
+ Invocations are interpreted straight from the CDFG. Each basic block is evaluated in program
+ order, memory is accessed through functional accesses and calls run to completion before the
+ caller continues. Every static instruction has a single instance whose register is shared
+ with the static graph, so operands read the most recent value of their producer.
+*********************************************************************************************/
+std::shared_ptr<SALAM::Instruction>
+LLVMInterface::functionalInstance(std::shared_ptr<SALAM::Instruction> inst) {
+    auto &instance = functionalInstances.at(inst->getUID());
+    if (!instance) instance = inst->clone();
+    return instance;
+}
+
+void
+LLVMInterface::resolveOperandsFunctional(std::shared_ptr<SALAM::Instruction> inst,
+                                         const std::vector<uint64_t> &registers) {
+    for (auto dep_uid : inst->runtimeInitialize(registers.data())) {
+        auto &producer = functionalInstances.at(dep_uid);
+        inst->setOperandValue(dep_uid, producer ? producer->getReg() : nullptr);
+    }
+}
+
+void
+LLVMInterface::executeFunctional(std::shared_ptr<SALAM::Function> func,
+                                 std::shared_ptr<SALAM::Instruction> caller) {
+    if (dbg) DPRINTF(LLVMInterface, "Executing Function: %s\n", func->getIRStub());
+    loadArguments(func, caller);
+    std::vector<uint64_t> registers = func->getRegisterImage();
+    func->loadArgumentRegisters(registers);
+    std::shared_ptr<SALAM::BasicBlock> previousBB = nullptr;
+    std::shared_ptr<SALAM::BasicBlock> bb = func->entry();
+    while (bb) {
+        if (dbg) DPRINTF(Runtime, "|---[Execute BB - UID:%i ]\n", bb->getUID());
+        auto instructions = bb->Instructions();
+        std::shared_ptr<SALAM::BasicBlock> nextBB = nullptr;
+        // Phis take their incoming values as of block entry, so all of them
+        // are resolved before any of them updates its register
+        size_t phis = 0;
+        for (; (phis < instructions->size()) && instructions->at(phis)->isPhi(); phis++) {
+            auto phi = std::static_pointer_cast<SALAM::Phi>(functionalInstance(instructions->at(phis)));
+            phi->setPrevBB(previousBB);
+            resolveOperandsFunctional(phi, registers);
+        }
+        for (size_t i = 0; i < instructions->size(); i++) {
+            auto inst = functionalInstance(instructions->at(i));
+            functionalInsts++;
+            if (i >= phis) resolveOperandsFunctional(inst, registers);
+            if (inst->isReturn()) {
+                if ((caller != nullptr) && (caller->getSize() > 0))
+                    caller->setRegisterValue(inst->getOperands()->front().getLockedData());
+                return;
+            } else if (inst->isTerminator()) {
+                nextBB = inst->getTarget();
+            } else if (inst->isLoad() || inst->isStore() || inst->isAtomic() || inst->isMemoryIntrinsic()) {
+                executeMemoryFunctional(inst);
+            } else if (inst->isCall() && !std::static_pointer_cast<SALAM::Call>(inst)->isIntrinsic()) {
+                auto calleeValue = std::static_pointer_cast<SALAM::Call>(inst)->getCalleeValue();
+                auto callee = std::dynamic_pointer_cast<SALAM::Function>(calleeValue);
+                assert(callee);
+                executeFunctional(callee, inst);
+            } else {
+                inst->execute();
+            }
+        }
+        previousBB = bb;
+        bb = nextBB;
+    }
+    panic("Function %s ended without a return\n", func->getIRStub());
+}
+
+void
+LLVMInterface::executeMemoryFunctional(std::shared_ptr<SALAM::Instruction> inst) {
+    if (inst->isLoad()) {
+        auto load = std::static_pointer_cast<SALAM::Load>(inst);
+        if (load->isLoadingInternal()) {
+            load->loadInternal();
+            return;
+        }
+        auto memReq = inst->createMemoryRequest();
+        comm->functionalRead(memReq);
+        inst->setRegisterValue(memReq->getBuffer());
+        inst->compute();
+        delete memReq;
+    } else if (inst->isStore()) {
+        auto memReq = inst->createMemoryRequest();
+        comm->functionalWrite(memReq);
+        delete memReq;
+    } else if (inst->isAtomic()) {
+        // The buffer returns the value memory held before the update
+        auto memReq = inst->createMemoryRequest();
+        comm->functionalRead(memReq);
+        inst->setAtomicResult(memReq->getBuffer());
+        inst->execute();
+        delete memReq;
+    } else {
+        auto callInst = std::static_pointer_cast<SALAM::Call>(inst);
+        if (callInst->getBurstLength() == 0) return;
+        auto memReq = callInst->createMemoryRequest();
+        if (callInst->getIntrinsic() == SALAM::IntrinsicKind::MemSet) {
+            comm->functionalWrite(memReq);
+        } else {
+            comm->functionalRead(memReq);
+            auto writeReq = callInst->createWriteBurst(memReq->getBuffer());
+            comm->functionalWrite(writeReq);
+            delete writeReq;
+        }
+        delete memReq;
+    }
+}
+
+void LLVMInterface::ActiveFunction::launch() {
+    // if (DTRACE(Trace)) if (dbg) DPRINTFS(Runtime, owner,  "Trace: %s \n", __PRETTY_FUNCTION__);
+    if (dbg) DPRINTFS(LLVMInterface, owner, "Launching Function: %s\n", func->getIRStub());
+    // func->value_dump();
+    // Fetch the arguments
+    std::vector<std::shared_ptr<SALAM::Value>> funcArgs = *(func->getArguments());
+    if (func->isTop()) {
+        if (dbg) DPRINTFS(LLVMInterface, owner, "Connecting HWInterface\n");
+        hw = owner->getHWInterface();
+    }
+    owner->loadArguments(func, caller);
+    registers = func->getRegisterImage();
+    func->loadArgumentRegisters(registers);
+    if (func->isConcurrent()) {
+        // Keep a private copy of the arguments for this instance
+        for (auto arg : funcArgs) {
+            argSnapshot.push_back(SALAM::Operand(arg));
+            argSnapshot.back().updateOperandRegister();
         }
     }
     func->addInstance();
@@ -1004,6 +2008,59 @@ LLVMInterface::createInstruction(llvm::Instruction * inst, uint64_t id) {
     // HW
     hw->opcodes->update_usage(OpCode);
 
+    // Vector arithmetic occupies a functional unit per lane. Only the lane-wise
+    // forms are modeled, other instructions producing vectors are rejected
+    unsigned lanes = 1;
+    if (inst->getType()->isVectorTy()) {
+        if (llvm::isa<llvm::BinaryOperator>(inst)) {
+            lanes = SALAM::vectorLanes(inst->getType());
+        } else if (!llvm::isa<llvm::LoadInst>(inst) && !llvm::isa<llvm::PHINode>(inst) &&
+                   !llvm::isa<llvm::SelectInst>(inst) && !llvm::isa<llvm::InsertElementInst>(inst) &&
+                   !llvm::isa<llvm::ShuffleVectorInst>(inst)) {
+            fatal("Vector form of %s is not supported\n", inst->getOpcodeName());
+        }
+        if (auto select = llvm::dyn_cast<llvm::SelectInst>(inst)) {
+            if (select->getCondition()->getType()->isVectorTy())
+                fatal("Lane-wise select is not supported\n");
+        }
+    }
+
+    // Intrinsics execute in place of the call and take the latency of their
+    // operation. Bulk memory intrinsics are timed by the memory system
+    uint64_t call_cycles = hw->cycle_counts->call_inst;
+    if (auto call = llvm::dyn_cast<llvm::CallInst>(inst)) {
+        if (llvm::Function * callee = call->getCalledFunction()) {
+            switch (SALAM::lookupIntrinsic(callee)) {
+                case SALAM::IntrinsicKind::None: break;
+                case SALAM::IntrinsicKind::FMulAdd: call_cycles = hw->cycle_counts->fmuladd_inst; break;
+                case SALAM::IntrinsicKind::Sqrt: call_cycles = hw->cycle_counts->sqrt_inst; break;
+                case SALAM::IntrinsicKind::FAbs: call_cycles = hw->cycle_counts->fabs_inst; break;
+                case SALAM::IntrinsicKind::MinNum:
+                case SALAM::IntrinsicKind::MaxNum: call_cycles = hw->cycle_counts->fminmax_inst; break;
+                case SALAM::IntrinsicKind::Unsupported:
+                    fatal("Call to %s cannot be simulated, only defined functions and "
+                          "supported intrinsics are modeled\n", callee->getName().str());
+                default: call_cycles = 0; break;
+            }
+        }
+    }
+
+    // Memory performs compare-exchange as a conditional swap, which scratchpads
+    // and the gem5 memory system only accept at 4 and 8 bytes
+    if (auto cmpxchg = llvm::dyn_cast<llvm::AtomicCmpXchgInst>(inst)) {
+        llvm::Type * compareType = cmpxchg->getCompareOperand()->getType();
+        unsigned bytes = compareType->isPointerTy() ? 8 : (compareType->getScalarSizeInBits() / 8);
+        if ((bytes != 4) && (bytes != 8))
+            fatal("cmpxchg on %d byte values is not supported, only 4 and 8 byte "
+                  "conditional swaps are modeled\n", bytes);
+    }
+
+    // Aggregates only appear as the { value, success } result of cmpxchg
+    if (auto extract = llvm::dyn_cast<llvm::ExtractValueInst>(inst)) {
+        if (!llvm::isa<llvm::AtomicCmpXchgInst>(extract->getAggregateOperand()))
+            fatal("extractvalue is only supported on the result of cmpxchg\n");
+    }
+
     uint64_t functional_unit = 0;
     for (auto hw_inst : hw->inst_config->inst_list) {
         //std::cout << "\n\n\nTest 7 OpCode[" << OpCode << "] | Compare: ["<< hw_inst->get_opcode_num() << "]\n\n\n";
@@ -1014,7 +2071,8 @@ LLVMInterface::createInstruction(llvm::Instruction * inst, uint64_t id) {
                 //std::cout << "\n\n\nTest 5\n\n\n";
                 if(hw_fu->get_enum_value() == functional_unit) {
                     //std::cout << "\n\n\nTest 6\n\n\n";
-                    hw_fu->inc_functional_unit_limit();
+                    for (unsigned lane = 0; lane < lanes; lane++) hw_fu->inc_functional_unit_limit();
+                    hw_fu->constrain_functional_unit_limit(hw_inst->get_functional_unit_limit());
                     break;
                 }
             }
@@ -1061,8 +2119,14 @@ LLVMInterface::createInstruction(llvm::Instruction * inst, uint64_t id) {
         case llvm::Instruction::ICmp: return SALAM::createICmpInst(id, this, debug(), OpCode, hw->cycle_counts->icmp_inst, functional_unit); break;
         case llvm::Instruction::FCmp: return SALAM::createFCmpInst(id, this, debug(), OpCode, hw->cycle_counts->fcmp_inst, functional_unit); break;
         case llvm::Instruction::PHI: return SALAM::createPHIInst(id, this, debug(), OpCode, hw->cycle_counts->phi_inst, functional_unit); break;
-        case llvm::Instruction::Call: return SALAM::createCallInst(id, this, debug(), OpCode, hw->cycle_counts->call_inst, functional_unit); break;
+        case llvm::Instruction::Call: return SALAM::createCallInst(id, this, debug(), OpCode, call_cycles, functional_unit); break;
         case llvm::Instruction::Select: return SALAM::createSelectInst(id, this, debug(), OpCode, hw->cycle_counts->select_inst, functional_unit); break;
+        case llvm::Instruction::ExtractElement: return SALAM::createExtractElementInst(id, this, debug(), OpCode, hw->cycle_counts->extractelement_inst, functional_unit); break;
+        case llvm::Instruction::InsertElement: return SALAM::createInsertElementInst(id, this, debug(), OpCode, hw->cycle_counts->insertelement_inst, functional_unit); break;
+        case llvm::Instruction::ShuffleVector: return SALAM::createShuffleVectorInst(id, this, debug(), OpCode, hw->cycle_counts->shufflevector_inst, functional_unit); break;
+        case llvm::Instruction::AtomicRMW: return SALAM::createAtomicRMWInst(id, this, debug(), OpCode, hw->cycle_counts->atomicrmw_inst, functional_unit); break;
+        case llvm::Instruction::AtomicCmpXchg: return SALAM::createCmpXchgInst(id, this, debug(), OpCode, hw->cycle_counts->cmpxchg_inst, functional_unit); break;
+        case llvm::Instruction::ExtractValue: return SALAM::createExtractValueInst(id, this, debug(), OpCode, hw->cycle_counts->extractvalue_inst, functional_unit); break;
         default: {
             warn("Tried to create instance of undefined instruction type!"); 
             return SALAM::createBadInst(id, this, dbg, OpCode, 0, 0); break;
@@ -4,38 +4,53 @@
 // C++ Includes
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
 #include <queue>
 #include <ratio>
+#include <set>
+#include <sstream>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 
 // LLVM Includes
 #include <llvm-c/Core.h>
 #include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
 #include <llvm/IR/Dominators.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Metadata.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/xxhash.h>
 #include <llvm/Transforms/Utils/Cloning.h>
 
 // SALAM Includes
 #include "hwacc/HWModeling/src/hw_interface.hh"
 #include "hwacc/LLVMRead/src/basic_block.hh"
+#include "hwacc/LLVMRead/src/block_jit.hh"
 #include "hwacc/LLVMRead/src/debug_flags.hh"
 #include "hwacc/LLVMRead/src/function.hh"
 #include "hwacc/LLVMRead/src/operand.hh"
+#include "base/statistics.hh"
 #include "hwacc/compute_unit.hh"
 #include "params/LLVMInterface.hh"
 
@@ -43,6 +58,26 @@ class LLVMInterface : public ComputeUnit {
   private:
     std::string filename;
     std::string topName;
+    std::string irCacheDir;
+    bool irCacheHit;
+    // Functions allowed more than one concurrent instance, with their limits
+    std::vector<std::pair<std::string, unsigned>> instanceLimits;
+    std::vector<std::shared_ptr<SALAM::Function>> limitedFunctions;
+    // Pipelined loops, keyed by the UID of their latching branch. Target II
+    // and overlap come from loop metadata or the pipeline_loops parameter
+    struct LoopPipeline {
+        std::string name;
+        unsigned targetII;
+        unsigned maxOverlap;
+        uint64_t iterations = 0;
+        uint64_t intervalCycles = 0;
+        uint64_t intervals = 0;
+        uint64_t iiStalls = 0;
+        uint64_t overlapStalls = 0;
+    };
+    std::map<std::string, std::pair<unsigned, unsigned>> pipelineConfig;
+    unsigned pipelineMaxOverlap;
+    std::map<uint64_t, LoopPipeline> pipelinedLoops;
     uint32_t scheduling_threshold;
     int32_t clock_period;
     int cycle;
@@ -54,6 +89,9 @@ class LLVMInterface : public ComputeUnit {
     bool compOpScheduled;
     bool lockstep;
     bool dbg;
+    bool storeForwarding;
+    enum MemoryOrder { RELAXED, TSO, STRICT };
+    MemoryOrder memoryOrder;
     std::chrono::duration<float> setupTime;
     std::chrono::duration<float> simTotal;
     std::chrono::duration<float> simTime;
@@ -64,6 +102,45 @@ class LLVMInterface : public ComputeUnit {
     std::chrono::high_resolution_clock::time_point simStop;
     std::chrono::high_resolution_clock::time_point setupStop;
     std::chrono::high_resolution_clock::time_point timeStart;
+    // Functional execution. Invocations run in program order against memory
+    // through functional accesses, with no cycle modeling. A negative limit
+    // stays functional until switched to timing from the config
+    int functionalLimit;
+    bool functionalMode;
+    bool functionalRun;
+    uint64_t invocations;
+    uint64_t functionalInsts;
+    std::chrono::duration<float> functionalTime;
+    std::vector<std::shared_ptr<SALAM::Instruction>> functionalInstances;
+    // Native evaluation of the pure dataflow of each basic block. Lives as
+    // long as the static graph, which holds its kernels
+    bool jitCompute;
+    std::unique_ptr<SALAM::BlockJIT> blockJIT;
+    // Loop sampling. Sampled loops are keyed by the UID of their exiting
+    // branch, and an iteration ends each time the branch stays in the loop.
+    // Every period runs warmup and measured iterations in detail, then
+    // fast-forwards the rest functionally. Fast-forwarded iterations are
+    // costed at the mean cycles per iteration of the measured units
+    struct LoopSample {
+        std::string name;
+        uint64_t body;
+        uint64_t units = 0;
+        double sum = 0;
+        double sumSq = 0;
+        uint64_t measuredIterations = 0;
+        uint64_t skippedIterations = 0;
+        double mean() const { return units ? (sum / units) : 0; }
+        double variance() const;
+    };
+    unsigned samplingPeriod;
+    unsigned sampleWarmup;
+    unsigned sampleSize;
+    std::set<std::string> samplingConfig;
+    std::map<uint64_t, LoopSample> sampledLoops;
+    // Runtime of the last invocation with fast-forwarded iterations costed
+    // in, and the half-width of its 95% confidence interval
+    double extrapolatedCycles;
+    double extrapolationError;
 
 
     class ActiveFunction {
@@ -73,52 +150,181 @@ class LLVMInterface : public ComputeUnit {
         HWInterface* hw;
         std::shared_ptr<SALAM::Function> func;
         std::shared_ptr<SALAM::Instruction> caller;
-        std::list<std::shared_ptr<SALAM::Instruction>> reservation;
+        // Reservation table and the subset of it whose dependencies are met,
+        // both keyed by scheduling sequence to preserve program order
+        SALAM::dynamicQueueTy reservation;
+        SALAM::dynamicQueueTy readyQueue;
+        uint64_t sequence = 0;
+        // Most recently scheduled instance of each static instruction, indexed by UID
+        std::vector<std::shared_ptr<SALAM::Instruction>> lastProducer;
         std::map<uint64_t, std::shared_ptr<SALAM::Instruction>> readQueue;
         std::map<MemoryRequest *, uint64_t> readQueueMap;
         std::map<uint64_t, std::shared_ptr<SALAM::Instruction>> writeQueue;
         std::map<MemoryRequest *, uint64_t> writeQueueMap;
         std::map<uint64_t, std::shared_ptr<SALAM::Instruction>> computeQueue;
+        // Scheduling sequence of every instance in the compute, read and write
+        // queues, so the oldest instance in flight is found without a scan
+        std::multiset<uint64_t> inFlightSequences;
+        typedef std::map<uint64_t, std::shared_ptr<SALAM::Instruction>> inFlightQueueTy;
+        inline void enqueue(inFlightQueueTy &queue, uint64_t uid, std::shared_ptr<SALAM::Instruction> inst) {
+          if (queue.insert({uid, inst}).second) inFlightSequences.insert(inst->getSequence());
+        }
+        inline inFlightQueueTy::iterator dequeue(inFlightQueueTy &queue, inFlightQueueTy::iterator it) {
+          inFlightSequences.erase(inFlightSequences.find(it->second->getSequence()));
+          return queue.erase(it);
+        }
         std::shared_ptr<SALAM::BasicBlock> previousBB;
+        // Argument values of this instance, restored before scheduling when
+        // other instances of the function may have overwritten them
+        std::vector<SALAM::Operand> argSnapshot;
+        // Register file of this instance, see SALAM::Function::assignRegisterSlots
+        std::vector<uint64_t> registers;
+        // Iterations of each pipelined loop, keyed by latching branch UID
+        struct LoopState {
+            int lastLaunch = -1;
+            // Sequence of the latching branch closing each iteration still in flight
+            std::deque<uint64_t> openIterations;
+        };
+        std::map<uint64_t, LoopState> loopStates;
+        // Position of each sampled loop in its sampling period, keyed by
+        // exiting branch UID. Cycles are -1 until the unit reaches them
+        struct SampleState {
+            unsigned phase = 0;
+            int unitStart = -1;
+            int unitEnd = -1;
+        };
+        std::map<uint64_t, SampleState> sampleStates;
         HW_Cycle_Stats hw_cycle_stats;
         uint32_t scheduling_threshold;
         bool returned = false;
         bool lockstep;
         bool dbg;
 
+        inline void reserve(std::shared_ptr<SALAM::Instruction> inst) {
+          inst->setReadyQueue(&readyQueue, sequence);
+          reservation.insert({sequence, inst});
+          if (inst->getDependencyCount() == 0) readyQueue.insert({sequence, inst});
+          if (memoryOrder != RELAXED) {
+            if (inst->isStore() || inst->isMemoryIntrinsic() || inst->isAtomic()) {
+              unissuedStores.insert(sequence);
+              if (memoryOrder == TSO) unplacedStores.insert(sequence);
+            } else if (inst->isLoad() && !inst->isLoadingInternal()) {
+              unissuedLoads.insert(sequence);
+            }
+          }
+          sequence++;
+        }
+        inline SALAM::dynamicQueueTy::iterator unreserve(SALAM::dynamicQueueTy::iterator ready_iter) {
+          ready_iter->second->clearReadyQueue();
+          reservation.erase(ready_iter->first);
+          if (memoryOrder != RELAXED) {
+            unissuedLoads.erase(ready_iter->first);
+            unissuedStores.erase(ready_iter->first);
+          }
+          if (memoryOrder == TSO) {
+            unplacedStores.erase(ready_iter->first);
+            placedStores.untrack(ready_iter->first);
+          }
+          return readyQueue.erase(ready_iter);
+        }
+
         inline bool uidActive(uint64_t id) {
           return computeUIDActive(id) || readUIDActive(id) || writeUIDActive(id);
         }
 
-        std::map<Addr, std::shared_ptr<SALAM::Instruction>> activeWrites;
-        inline void trackWrite(Addr writeAddr, std::shared_ptr<SALAM::Instruction> writeInst) {
-          activeWrites.insert({writeAddr, writeInst});
+        // Load/store queue. Accesses in flight to memory are checked for byte
+        // overlap against new loads and stores. The order of an access is
+        // when it issued, or its reservation sequence before it has
+        struct MemAccess {
+            Addr addr;
+            size_t size;
+            std::shared_ptr<SALAM::Instruction> inst;
+            MemoryRequest * req;
+            uint64_t order;
+            inline bool overlaps(Addr a, size_t s) const { return (a < addr + size) && (addr < a + s); }
+            inline bool covers(Addr a, size_t s) const { return (a >= addr) && (a + s <= addr + size); }
+        };
+        // Accesses indexed by start address. An overlap query only visits
+        // accesses starting within the largest tracked size below the range
+        template <typename Key>
+        class AccessTable {
+          private:
+            typedef std::multimap<Addr, MemAccess> accessMapTy;
+            accessMapTy accesses;
+            std::unordered_map<Key, typename accessMapTy::iterator> index;
+            std::multiset<size_t> sizes;
+          public:
+            void track(Key key, const MemAccess &access) {
+              index[key] = accesses.insert({access.addr, access});
+              sizes.insert(access.size);
+            }
+            void untrack(Key key) {
+              auto it = index.find(key);
+              if (it == index.end()) return;
+              sizes.erase(sizes.find(it->second->second.size));
+              accesses.erase(it->second);
+              index.erase(it);
+            }
+            void rekey(Key from, Key to) {
+              auto it = index.find(from);
+              if (it == index.end()) return;
+              auto access = it->second;
+              index.erase(it);
+              index[to] = access;
+            }
+            // Youngest access overlapping [a, a + s) that is older than before
+            MemAccess * youngestOverlap(Addr a, size_t s, uint64_t before = std::numeric_limits<uint64_t>::max()) {
+              if (accesses.empty()) return nullptr;
+              size_t span = *sizes.rbegin();
+              Addr from = (a >= span) ? (a - span + 1) : 0;
+              MemAccess * youngest = nullptr;
+              for (auto it = accesses.lower_bound(from); (it != accesses.end()) && (it->first < a + s); ++it) {
+                auto &access = it->second;
+                if ((access.order < before) && access.overlaps(a, s) &&
+                    (!youngest || (access.order > youngest->order)))
+                  youngest = &access;
+              }
+              return youngest;
+            }
+        };
+        AccessTable<MemoryRequest *> inflightLoads;
+        AccessTable<MemoryRequest *> inflightStores;
+        uint64_t issuedAccesses = 0;
+        inline void trackAccess(AccessTable<MemoryRequest *> &table, Addr a, size_t s,
+                                std::shared_ptr<SALAM::Instruction> inst, MemoryRequest * req) {
+          table.track(req, {a, s, inst, req, issuedAccesses++});
         }
-        inline void untrackWrite(uint64_t writeAddr) {
-          auto it = activeWrites.find(writeAddr);
-          if (it != activeWrites.end()) activeWrites.erase(it);
+        // Reservation sequence of accesses that have not issued yet. Only
+        // tracked when the ordering policy is stricter than relaxed
+        MemoryOrder memoryOrder;
+        std::set<uint64_t> unissuedLoads;
+        std::set<uint64_t> unissuedStores;
+        // Under TSO, unissued plain stores are placed by address once their
+        // pointer resolves. Stores not placed yet may alias anything
+        std::set<uint64_t> unplacedStores;
+        AccessTable<uint64_t> placedStores;
+        inline bool olderUnissued(const std::set<uint64_t> &unissued, uint64_t seq) {
+          return !unissued.empty() && (*unissued.begin() < seq);
         }
-        inline bool writeActive(uint64_t writeAddr) {
-          return (activeWrites.find(writeAddr) != activeWrites.end());
-        }
-
-        inline std::shared_ptr<SALAM::Instruction> getActiveWrite(uint64_t writeAddr) {
-          return activeWrites.find(writeAddr)->second;
-        }
-        // std::map<Addr, std::shared_ptr<SALAM::Instruction>> activeReads;
-        // inline void trackRead(Addr readAddr, std::shared_ptr<SALAM::Instruction> readInst) {
-        //   activeReads.insert({readAddr, readInst});
-        // }
-        // inline void untrackRead(uint64_t readAddr) {
-        //   auto it = activeReads.find(readAddr);
-        //   if (it != activeReads.end()) activeReads.erase(it);
-        // }
-        // inline bool readActive(uint64_t readAddr) {
-        //   return (activeReads.find(readAddr) != activeReads.end());
-        // }
-        // inline std::shared_ptr<SALAM::Instruction> getActiveRead(uint64_t readAddr) {
-        //   return activeReads.find(readAddr)->second;
-        // }
+        bool orderingStall(std::shared_ptr<SALAM::Instruction> inst);
+        bool olderStoreAliases(std::shared_ptr<SALAM::Instruction> loadInst);
+        uint64_t oldestInFlight(uint64_t skip);
+        bool latchStall(std::shared_ptr<SALAM::Instruction> inst);
+        void recordLatch(std::shared_ptr<SALAM::Instruction> inst);
+        void forwardStore(std::shared_ptr<SALAM::Instruction> loadInst, const MemAccess &store);
+        bool burstHazard(std::shared_ptr<SALAM::Call> callInst);
+        void launchBurst(std::shared_ptr<SALAM::Call> callInst);
+        void continueBurst(std::shared_ptr<SALAM::Call> callInst, MemoryRequest * readReq);
+        void launchAtomic(std::shared_ptr<SALAM::Instruction> atomicInst);
+        bool canFastForward();
+        bool samplingStall(std::shared_ptr<SALAM::Instruction> inst);
+        std::shared_ptr<SALAM::BasicBlock> sampleIteration(std::shared_ptr<SALAM::Instruction> inst,
+                                                           std::shared_ptr<SALAM::BasicBlock> nextBB);
+        std::shared_ptr<SALAM::BasicBlock> fastForward(std::shared_ptr<SALAM::Instruction> branch,
+                                                       std::shared_ptr<SALAM::BasicBlock> bb,
+                                                       uint64_t iterations);
+        // Issue cycle of each atomic awaiting its response
+        std::map<MemoryRequest *, int> atomicIssueCycle;
         inline bool writeUIDActive(uint64_t uid) {
           return (writeQueue.find(uid) != writeQueue.end());
         }
@@ -134,7 +340,9 @@ class LLVMInterface : public ComputeUnit {
                        owner(_owner), func(_func), caller(_caller),
                        previousBB(nullptr) {
                           scheduling_threshold = owner->getSchedulingThreshold();
+                          lastProducer.resize(owner->getValueCount());
                           lockstep = (owner->getLockstepStatus());
+                          memoryOrder = owner->memoryOrder;
                           dbg = owner->debug();
                        }
         void readCommit(MemoryRequest *req);
@@ -150,13 +358,112 @@ class LLVMInterface : public ComputeUnit {
           return !lockstep || queuesClear();
         }
         inline bool canReturn() {
-            return queuesClear() && reservation.front()->isReturn();
+            return queuesClear() && reservation.begin()->second->isReturn();
         }
         void launchRead(std::shared_ptr<SALAM::Instruction> readInst);
         void launchWrite(std::shared_ptr<SALAM::Instruction> writeInst);
         bool hasReturned() { return returned; }
     };
 
+    // Dynamic instances of a single static instruction. The pool owns its
+    // instances and hands out references that return the instance to the
+    // free list once the last of them is dropped.
+    struct InstancePool {
+        std::vector<std::shared_ptr<SALAM::Instruction>> instances;
+        std::vector<SALAM::Instruction *> free;
+    };
+    std::vector<InstancePool> instancePools;
+
+    struct LLVMInterfaceStats : public statistics::Group
+    {
+        LLVMInterfaceStats(LLVMInterface &llvm_interface);
+
+        /** Dynamic instruction instances allocated by cloning */
+        statistics::Scalar instancesAllocated;
+        /** Dynamic instruction instances reused from the instance pools */
+        statistics::Scalar instancesRecycled;
+        /** Fraction of scheduled instances served from the pools */
+        statistics::Formula instanceRecycleRate;
+        /** Issue attempts denied by a busy functional unit, per unit */
+        statistics::Vector fuStalls;
+        /** Per cycle occupancy of each functional unit */
+        std::vector<statistics::Histogram *> fuOccupancy;
+        /** Loads served by forwarding from an in-flight store */
+        statistics::Scalar forwardedLoads;
+        /** Loads held for an overlapping in-flight store */
+        statistics::Scalar rawStalls;
+        /** Stores held for an overlapping in-flight load */
+        statistics::Scalar warStalls;
+        /** Stores held for an overlapping in-flight store */
+        statistics::Scalar wawStalls;
+        /** Memory accesses held back by the ordering policy */
+        statistics::Scalar orderingStalls;
+        /** Total memory hazard stalls */
+        statistics::Formula hazardStalls;
+        /** Bytes held by the shared static instruction descriptors */
+        statistics::Value staticFootprint;
+        /** Approximate bytes held by pooled dynamic instruction instances */
+        statistics::Value dynamicFootprint;
+        /** Function instances launched */
+        statistics::Scalar functionLaunches;
+        /** Cycles a call waited for a free instance of its callee */
+        statistics::Scalar callStalls;
+        /** Function instances active per cycle */
+        statistics::Histogram activeFunctionInstances;
+        /** Launches of each function with a configured instance limit */
+        statistics::Vector instanceLaunches;
+        /** Call stalls of each function with a configured instance limit */
+        statistics::Vector instanceStalls;
+        /** Per cycle active instances of each function with a configured limit */
+        std::vector<statistics::Histogram *> instanceOccupancy;
+        /** Iterations launched by pipelined loops */
+        statistics::Scalar pipelinedIterations;
+        /** Cycles pipelined loop iterations waited for the initiation interval */
+        statistics::Scalar pipelineIIStalls;
+        /** Cycles pipelined loop iterations waited for an overlap slot */
+        statistics::Scalar pipelineOverlapStalls;
+        /** Bulk memory intrinsics issued as bursts */
+        statistics::Scalar bursts;
+        /** Bytes moved or set by bulk memory intrinsics */
+        statistics::Scalar burstBytes;
+        /** Cycles a bulk memory intrinsic waited for overlapping accesses */
+        statistics::Scalar burstStalls;
+        /** Atomic read-modify-writes and compare-exchanges issued */
+        statistics::Scalar atomicOps;
+        /** Atomics held for an overlapping in-flight access */
+        statistics::Scalar atomicStalls;
+        /** Compare-exchanges that found an unexpected value */
+        statistics::Scalar casFailures;
+        /** Cycles from issue to response of each atomic */
+        statistics::Histogram atomicLatency;
+        /** Invocations executed functionally */
+        statistics::Scalar functionalInvocations;
+        /** Instructions executed functionally */
+        statistics::Scalar functionalInsts;
+        /** Host seconds spent executing functionally */
+        statistics::Scalar functionalHostSeconds;
+        /** Functionally executed instructions per host second */
+        statistics::Formula functionalIPS;
+        /** Basic blocks compiled by the block JIT */
+        statistics::Scalar jitBlocks;
+        /** Static instructions evaluated through JIT kernels */
+        statistics::Scalar jitKernels;
+        /** Host seconds spent compiling basic blocks */
+        statistics::Scalar jitCompileSeconds;
+        /** Sampling units measured in detail */
+        statistics::Scalar sampledUnits;
+        /** Loop iterations measured by sampling units */
+        statistics::Scalar sampledIterations;
+        /** Loop iterations fast-forwarded functionally */
+        statistics::Scalar fastForwardedIterations;
+        /** Instructions executed while fast-forwarding */
+        statistics::Scalar fastForwardedInsts;
+        /** Cycles with fast-forwarded iterations costed at the sampled rate */
+        statistics::Scalar extrapolatedCycles;
+        /** Half-width of the 95% confidence interval of the extrapolated cycles */
+        statistics::Scalar extrapolationError;
+    } stats;
+
     std::list<ActiveFunction> activeFunctions;
     std::map<MemoryRequest *, ActiveFunction *> globalReadQueue;
     std::map<MemoryRequest *, ActiveFunction *> globalWriteQueue;
@@ -172,6 +479,7 @@ class LLVMInterface : public ComputeUnit {
     LLVMInterface(const LLVMInterfaceParams &p);
     void tick();
     void constructStaticGraph();
+    std::unique_ptr<llvm::Module> loadModule(llvm::LLVMContext &context, llvm::SMDiagnostic &error);
     void startup();
     void initialize();
     void finalize();
@@ -184,13 +492,34 @@ class LLVMInterface : public ComputeUnit {
     void launchFunction(std::shared_ptr<SALAM::Function> callee,
                         std::shared_ptr<SALAM::Instruction> caller);
     void launchTopFunction();
+    void loadArguments(std::shared_ptr<SALAM::Function> func,
+                       std::shared_ptr<SALAM::Instruction> caller);
+    void executeFunctional(std::shared_ptr<SALAM::Function> func,
+                           std::shared_ptr<SALAM::Instruction> caller);
+    void executeMemoryFunctional(std::shared_ptr<SALAM::Instruction> inst);
+    std::shared_ptr<SALAM::Instruction> functionalInstance(std::shared_ptr<SALAM::Instruction> inst);
+    void resolveOperandsFunctional(std::shared_ptr<SALAM::Instruction> inst,
+                                   const std::vector<uint64_t> &registers);
+    void printFunctionalResults();
+    // Take effect from the next invocation, like a CPU switch at a quiesce point
+    void switchToTiming() { functionalMode = false; }
+    void switchToFunctional() { functionalMode = true; functionalLimit = -1; }
     void endFunction(ActiveFunction * afunc);
     void launchRead(MemoryRequest * memReq, ActiveFunction * func);
     void launchWrite(MemoryRequest * memReq, ActiveFunction * func);
     std::shared_ptr<SALAM::Instruction> createInstruction(llvm::Instruction *inst,
                                                           uint64_t id);
+    std::shared_ptr<SALAM::Instruction> acquireInstance(std::shared_ptr<SALAM::Instruction> inst,
+                                                        bool isolate);
+    int limitedFunctionIndex(std::shared_ptr<SALAM::Function> func);
+    static std::vector<std::pair<std::string, unsigned>>
+    parseInstanceLimits(const std::vector<std::string> &entries);
+    static std::map<std::string, std::pair<unsigned, unsigned>>
+    parsePipelineLoops(const std::vector<std::string> &entries);
+    void extrapolateSampling();
     void dumpQueues();
     uint32_t getSchedulingThreshold() { return scheduling_threshold; }
+    size_t getValueCount() { return values.size(); }
     void addSchedulingTime(std::chrono::duration<float> timeDelta) { schedulingTime = schedulingTime + timeDelta; }
     void addQueueTime(std::chrono::duration<float> timeDelta) { queueProcessTime = queueProcessTime + timeDelta; }
     void addComputeTime(std::chrono::duration<float> timeDelta) { computeTime = computeTime + timeDelta; }
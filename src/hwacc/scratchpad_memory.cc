@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <iomanip>
 
 using namespace std;
@@ -26,17 +27,42 @@ ScratchpadMemory::ScratchpadMemory(const ScratchpadMemoryParams &p) :
     writeOnValid(p.write_on_valid),
     resetOnScratchpadRead(p.reset_on_scratchpad_read),
     initial(true),
+    readyGranularity(p.ready_granularity > 0 ? p.ready_granularity : 1),
+    numBanks(p.num_banks > 0 ? p.num_banks : 1),
+    bankWordSize(p.bank_word_size > 0 ? p.bank_word_size : 1),
+    bankMask(p.bank_mask),
+    bankReadPorts(p.bank_read_ports),
+    bankWritePorts(p.bank_write_ports),
+    spmStats(*this),
     port(name() + ".port", *this),
     latency(p.latency),
     latency_var(p.latency_var),
     bandwidth(p.bandwidth),
+    bankReleaseEvent([this]{ releaseBanks(); }, name() + "_bank_release"),
     dequeueEvent([this]{ dequeue(); }, name()) {
-    ready = new bool[range.size()];
     if (readyMode) {
-        for (auto i=0;i<range.size();i++) {
-            ready[i] = false;
-        }
+        uint64_t granules = (range.size() + readyGranularity - 1) / readyGranularity;
+        readyBits.resize((granules + 63) / 64, 0);
+    }
+    if (p.interleaving == "cyclic") {
+        interleaving = CYCLIC;
+    } else if (p.interleaving == "block") {
+        interleaving = BLOCK;
+    } else if (p.interleaving == "mask") {
+        interleaving = MASK;
+        fatal_if(bankMask == 0, "%s: mask interleaving requires a bank_mask\n", name());
+    } else {
+        fatal("%s: unknown bank interleaving %s\n", name(), p.interleaving);
     }
+    bankSize = (range.size() + numBanks - 1) / numBanks;
+    banks.resize(numBanks);
+    bankTouched.resize(numBanks, false);
+    for (auto &bank : banks) {
+        bank.readPorts.resize(bankReadPorts, 0);
+        bank.writePorts.resize(bankWritePorts, 0);
+    }
+    // A single bank without port limits behaves as the unbanked memory
+    banked = (bankReadPorts > 0) || (bankWritePorts > 0);
     // Each port has its own release and dequeue events, as well as signals
     // Adding these events and signals for ".port"
     // const std::string releaseEventName = csprintf("%s_release[0]", name());
@@ -45,9 +71,147 @@ ScratchpadMemory::ScratchpadMemory(const ScratchpadMemoryParams &p) :
     releaseTick.push_back(0);
     isBusy.push_back(false);
     retryReq.push_back(false);
+    conflictPkt.push_back(nullptr);
     retryResp.push_back(false);
 }
 
+ScratchpadMemory::ScratchpadStats::ScratchpadStats(ScratchpadMemory &spm)
+    : statistics::Group(&spm),
+    ADD_STAT(bankReads, statistics::units::Count::get(),
+             "Read accesses served by each bank"),
+    ADD_STAT(bankWrites, statistics::units::Count::get(),
+             "Write accesses served by each bank"),
+    ADD_STAT(bankConflicts, statistics::units::Count::get(),
+             "Requests rejected because the bank had no free port, retries excluded"),
+    ADD_STAT(bankConflictStalls, statistics::units::Count::get(),
+             "Requests stalled on a bank conflict"),
+    ADD_STAT(atomicAccesses, statistics::units::Count::get(),
+             "Atomic swaps and read-modify-writes served")
+{
+    bankReads.init(spm.numBanks);
+    bankWrites.init(spm.numBanks);
+    bankConflicts.init(spm.numBanks);
+    for (unsigned i = 0; i < spm.numBanks; i++) {
+        const std::string bank = "bank" + std::to_string(i);
+        bankReads.subname(i, bank);
+        bankWrites.subname(i, bank);
+        bankConflicts.subname(i, bank);
+    }
+}
+
+unsigned
+ScratchpadMemory::bankIndex(Addr offset) const
+{
+    switch (interleaving) {
+      case BLOCK:
+        return std::min<Addr>(offset / bankSize, numBanks - 1);
+      case MASK: {
+        // Gather the masked offset bits into the bank number
+        unsigned bank = 0;
+        unsigned bit = 0;
+        for (Addr mask = bankMask; mask != 0; mask &= (mask - 1)) {
+            if (offset & (mask & -mask)) bank |= (1 << bit);
+            bit++;
+        }
+        return bank % numBanks;
+      }
+      default:
+        return (offset / bankWordSize) % numBanks;
+    }
+}
+
+void
+ScratchpadMemory::collectBanks(PacketPtr pkt)
+{
+    accessBanks.clear();
+    if (pkt->getSize() == 0) return;
+    Addr first = pkt->getAddr() - range.start();
+    Addr last = first + pkt->getSize() - 1;
+    switch (interleaving) {
+      case BLOCK:
+        // Banks are contiguous ranges of the address space
+        for (unsigned bank = bankIndex(first); bank <= bankIndex(last); bank++)
+            accessBanks.push_back(bank);
+        break;
+      case MASK: {
+        // The bank number is constant within blocks aligned to the lowest
+        // masked bit, so one offset per block is enough
+        Addr granule = bankMask & -bankMask;
+        for (Addr block = first / granule; block <= last / granule; block++) {
+            unsigned bank = bankIndex(block * granule);
+            if (bankTouched[bank]) continue;
+            bankTouched[bank] = true;
+            accessBanks.push_back(bank);
+            if (accessBanks.size() == numBanks) break;
+        }
+        for (auto bank : accessBanks) bankTouched[bank] = false;
+        break;
+      }
+      default: {
+        // Consecutive words go to consecutive banks
+        Addr words = last / bankWordSize - first / bankWordSize + 1;
+        unsigned bank = bankIndex(first);
+        for (Addr word = 0; word < std::min<Addr>(words, numBanks); word++)
+            accessBanks.push_back((bank + word) % numBanks);
+        break;
+      }
+    }
+}
+
+// Tick at which the earliest free port of a bank can accept an access.
+// Banks without ports of a type never block it
+static inline Tick
+earliestPort(const std::vector<Tick> &ports)
+{
+    return ports.empty() ? 0 : *std::min_element(ports.begin(), ports.end());
+}
+
+static inline void
+claimPort(std::vector<Tick> &ports, Tick until)
+{
+    if (!ports.empty()) *std::min_element(ports.begin(), ports.end()) = until;
+}
+
+bool
+ScratchpadMemory::reserveBanks(PacketPtr pkt, PortID idx)
+{
+    // Every bank touched by the packet needs a free port of the right type.
+    // Atomic swaps read and write the same bytes and hold a port of each type
+    Tick now = curTick();
+    Tick retry_at = MaxTick;
+    bool conflict = false;
+    bool retried = (conflictPkt[idx] == pkt);
+    bool read = pkt->isRead();
+    bool write = pkt->isWrite();
+    for (auto bank : accessBanks) {
+        Tick read_at = read ? earliestPort(banks[bank].readPorts) : 0;
+        Tick write_at = write ? earliestPort(banks[bank].writePorts) : 0;
+        if (read_at > now) retry_at = std::min(retry_at, read_at);
+        if (write_at > now) retry_at = std::min(retry_at, write_at);
+        if ((read_at > now) || (write_at > now)) {
+            conflict = true;
+            if (!retried) spmStats.bankConflicts[bank]++;
+        }
+    }
+    if (conflict) {
+        if (!retried) spmStats.bankConflictStalls++;
+        conflictPkt[idx] = pkt;
+        if (!bankReleaseEvent.scheduled()) {
+            schedule(bankReleaseEvent, retry_at);
+        } else if (bankReleaseEvent.when() > retry_at) {
+            reschedule(bankReleaseEvent, retry_at);
+        }
+        return false;
+    }
+
+    conflictPkt[idx] = nullptr;
+    for (auto bank : accessBanks) {
+        if (read) claimPort(banks[bank].readPorts, now + clockPeriod());
+        if (write) claimPort(banks[bank].writePorts, now + clockPeriod());
+    }
+    return true;
+}
+
 bool
 ScratchpadMemory::isReady(Addr ad, size_t size, bool read) {
     if (!readyMode) {
@@ -56,30 +220,58 @@ ScratchpadMemory::isReady(Addr ad, size_t size, bool read) {
         // We are reading. We can read if readOnInvalid or
         // if all segments are valid.
         if (readOnInvalid) return true;
-        Addr start_offset = ad - range.start();
-        Addr end_offset = start_offset + size;
-        for (auto i=start_offset; i<end_offset; i++) {
-            if (ready[i] == false) return false;
-        }
+        return readyBitsEqual(ad - range.start(), size, true);
     } else {
         // We are writing. We can write if writeOnValid or
         // if all segments are invalid.
         if (writeOnValid) return true;
-        Addr start_offset = ad - range.start();
-        Addr end_offset = start_offset + size;
-        for (auto i=start_offset; i<end_offset; i++) {
-            if (ready[i] == true) return false;
-        }
+        return readyBitsEqual(ad - range.start(), size, false);
+    }
+    return true;
+}
+
+uint64_t
+ScratchpadMemory::readyWordMask(uint64_t word, uint64_t first, uint64_t last) const
+{
+    unsigned lo = (word == first / 64) ? (first % 64) : 0;
+    unsigned hi = (word == last / 64) ? (last % 64) : 63;
+    uint64_t upper = (hi == 63) ? ~0ULL : ((1ULL << (hi + 1)) - 1);
+    return upper & (~0ULL << lo);
+}
+
+bool
+ScratchpadMemory::readyBitsEqual(Addr offset, size_t size, bool value) const
+{
+    if (size == 0) return true;
+    uint64_t first = offset / readyGranularity;
+    uint64_t last = (offset + size - 1) / readyGranularity;
+    // Compare 64 granules at a time against the requested state
+    for (uint64_t word = first / 64; word <= last / 64; word++) {
+        uint64_t bits = value ? ~readyBits[word] : readyBits[word];
+        if (bits & readyWordMask(word, first, last)) return false;
     }
     return true;
 }
 
+void
+ScratchpadMemory::setReadyBits(Addr offset, size_t size, bool value)
+{
+    // Ready state is only allocated in ready mode
+    if (size == 0 || readyBits.empty()) return;
+    uint64_t first = offset / readyGranularity;
+    uint64_t last = (offset + size - 1) / readyGranularity;
+    for (uint64_t word = first / 64; word <= last / 64; word++) {
+        uint64_t mask = readyWordMask(word, first, last);
+        if (value) readyBits[word] |= mask;
+        else readyBits[word] &= ~mask;
+    }
+}
+
 void
 ScratchpadMemory::setAllReady(bool r) {
     if (readyMode && !initial){
-        for (auto i=0;i<range.size();i++) {
-            ready[i] = r;
-        }
+        // Bits past the end of the range are never checked
+        std::fill(readyBits.begin(), readyBits.end(), r ? ~0ULL : 0ULL);
     }
     initial = true;
 }
@@ -183,11 +375,7 @@ ScratchpadMemory::scratchpadAccess(PacketPtr pkt, bool validateAccess)
                 panic("Scratchpad read at address: 0x%lx is invalid! Sector has not been written yet!\n", pkt->getAddr());
             }
             if (resetOnScratchpadRead) {
-                Addr start_offset = pkt->getAddr() - range.start();
-                Addr end_offset = start_offset + pkt->getSize();
-                for (auto i=start_offset; i<end_offset; i++) {
-                    ready[i] = false;
-                }
+                setReadyBits(pkt->getAddr() - range.start(), pkt->getSize(), false);
             }
         }
         if (pmemAddr) {
@@ -223,11 +411,7 @@ ScratchpadMemory::scratchpadAccess(PacketPtr pkt, bool validateAccess)
         }
         // Set ready bits on external writes
         if (readyMode) {
-            Addr start_offset = pkt->getAddr() - range.start();
-            Addr end_offset = start_offset + pkt->getSize();
-            for (auto i=start_offset; i<end_offset; i++) {
-                ready[i] = true;
-            }
+            setReadyBits(pkt->getAddr() - range.start(), pkt->getSize(), true);
         }
     } else {
         panic("Unexpected packet %s", pkt->print());
@@ -270,12 +454,22 @@ ScratchpadMemory::recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &_backdoor)
 }
 
 void
-ScratchpadMemory::recvFunctional(PacketPtr pkt)
+ScratchpadMemory::recvFunctional(PacketPtr pkt, bool trackReady)
 {
     pkt->pushLabel(name());
 
     functionalAccess(pkt);
 
+    // Accelerators executing functionally hand data over through the
+    // ready bits just as their timing accesses do
+    if (readyMode && trackReady) {
+        if (pkt->isWrite()) {
+            setReadyBits(pkt->getAddr() - range.start(), pkt->getSize(), true);
+        } else if (pkt->isRead() && resetOnScratchpadRead) {
+            setReadyBits(pkt->getAddr() - range.start(), pkt->getSize(), false);
+        }
+    }
+
     bool done = false;
     auto p = packetQueue.begin();
     // potentially update the packets in our packet queue as well
@@ -312,6 +506,18 @@ ScratchpadMemory::recvTimingReq(PacketPtr pkt, PortID recvPort, bool validateAcc
         return false;
     }
 
+    // the banks holding the data need a free port this cycle
+    collectBanks(pkt);
+    if (banked && !reserveBanks(pkt, idx)) {
+        retryReq[idx] = true;
+        return false;
+    }
+    for (auto bank : accessBanks) {
+        if (pkt->isRead()) spmStats.bankReads[bank]++;
+        if (pkt->isWrite()) spmStats.bankWrites[bank]++;
+    }
+    if (pkt->cmd == MemCmd::SwapReq) spmStats.atomicAccesses++;
+
     // technically the packet only reaches us after the header delay,
     // and since this is a memory controller we also need to
     // deserialise the payload before performing any write operation
@@ -385,15 +591,32 @@ ScratchpadMemory::release()
             isBusy[idx] = false;
             if (retryReq[idx]) {
                 retryReq[idx] = false;
-                if (idx==0)
-                    port.sendRetryReq();
-                else
-                    spm_ports[idx-1]->sendRetryReq();
+                sendRetryReq(idx);
             }
         }
     }
 }
 
+void
+ScratchpadMemory::releaseBanks()
+{
+    for (unsigned idx = 0; idx < retryReq.size(); idx++) {
+        if (retryReq[idx] && !isBusy[idx]) {
+            retryReq[idx] = false;
+            sendRetryReq(idx);
+        }
+    }
+}
+
+void
+ScratchpadMemory::sendRetryReq(unsigned idx)
+{
+    if (idx==0)
+        port.sendRetryReq();
+    else
+        spm_ports[idx-1]->sendRetryReq();
+}
+
 void
 ScratchpadMemory::dequeue()
 {
@@ -452,6 +675,7 @@ ScratchpadMemory::getPort(const std::string &if_name, PortID idx)
             releaseTick.resize((idx+2), 0);
             isBusy.resize((idx+2), false);
             retryReq.resize((idx+2), false);
+            conflictPkt.resize((idx+2), nullptr);
             retryResp.resize((idx+2), false);
         }
         if (spm_ports[idx] == nullptr) {
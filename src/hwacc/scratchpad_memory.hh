@@ -1,6 +1,7 @@
 #ifndef __HWACC_SCRATCHPAD_MEMORY_HH__
 #define __HWACC_SCRATCHPAD_MEMORY_HH__
 
+#include "base/statistics.hh"
 #include "mem/abstract_mem.hh"
 #include "mem/port.hh"
 
@@ -67,7 +68,56 @@ class ScratchpadMemory : public AbstractMemory
     bool writeOnValid;
     bool resetOnScratchpadRead;
     bool initial;
-    bool *ready;
+
+    // Ready state, one bit per readyGranularity bytes of the range
+    std::vector<uint64_t> readyBits;
+    unsigned readyGranularity;
+    uint64_t readyWordMask(uint64_t word, uint64_t first, uint64_t last) const;
+    bool readyBitsEqual(Addr offset, size_t size, bool value) const;
+    void setReadyBits(Addr offset, size_t size, bool value);
+
+    // Address to bank mapping
+    enum Interleaving {
+        CYCLIC,
+        BLOCK,
+        MASK
+    };
+    Interleaving interleaving;
+    unsigned numBanks;
+    Addr bankSize;
+    unsigned bankWordSize;
+    Addr bankMask;
+    unsigned bankReadPorts;
+    unsigned bankWritePorts;
+    bool banked;
+
+    // Tick at which each port of a bank can accept its next access
+    struct Bank {
+        std::vector<Tick> readPorts;
+        std::vector<Tick> writePorts;
+    };
+    std::vector<Bank> banks;
+    std::vector<unsigned> accessBanks;
+    std::vector<bool> bankTouched;
+
+    struct ScratchpadStats : public statistics::Group
+    {
+        ScratchpadStats(ScratchpadMemory &spm);
+
+        /** Accesses served by each bank */
+        statistics::Vector bankReads;
+        statistics::Vector bankWrites;
+        /** Requests rejected because a bank had no free port, counted once
+         *  per request however often it is retried */
+        statistics::Vector bankConflicts;
+        statistics::Scalar bankConflictStalls;
+        /** Atomic swaps and read-modify-writes served */
+        statistics::Scalar atomicAccesses;
+    } spmStats;
+
+    unsigned bankIndex(Addr offset) const;
+    void collectBanks(PacketPtr pkt);
+    bool reserveBanks(PacketPtr pkt, PortID idx);
   public:
     // typedef ScratchpadMemoryParams Params;
     // const Params *
@@ -132,7 +182,7 @@ class ScratchpadMemory : public AbstractMemory
         Tick recvAtomic(PacketPtr pkt) override { return memory->recvAtomic(pkt, true); };
         Tick recvAtomicBackdoor(
                 PacketPtr pkt, MemBackdoorPtr &_backdoor) override { return memory->recvAtomicBackdoor(pkt,_backdoor); };
-        void recvFunctional(PacketPtr pkt) override { memory->recvFunctional(pkt); };
+        void recvFunctional(PacketPtr pkt) override { memory->recvFunctional(pkt, true); };
         bool recvTimingReq(PacketPtr pkt) override { return memory->recvTimingReq(pkt, id, true); };
         void recvRespRetry() override { memory->recvRespRetry(id); };
         AddrRangeList getAddrRanges() const override {
@@ -182,6 +232,12 @@ class ScratchpadMemory : public AbstractMemory
      */
     std::vector<bool> retryReq;
 
+    /**
+     * Request last rejected on a bank conflict at each port, so its
+     * retries are not counted as new conflicts.
+     */
+    std::vector<PacketPtr> conflictPkt;
+
     /**
      * Remember if we failed to send a response and are awaiting a
      * retry. This is only used as a check.
@@ -197,6 +253,15 @@ class ScratchpadMemory : public AbstractMemory
     std::vector<EventFunctionWrapper> releaseEvent;
     std::vector<Tick> releaseTick;
 
+    /**
+     * Retry requests that were rejected on a bank conflict once the
+     * next bank port frees up.
+     */
+    void releaseBanks();
+    void sendRetryReq(unsigned idx);
+
+    EventFunctionWrapper bankReleaseEvent;
+
     /**
      * Dequeue a packet from our internal packet queue and move it to
      * the port where it will be sent as soon as possible.
@@ -230,7 +295,7 @@ class ScratchpadMemory : public AbstractMemory
   protected:
     Tick recvAtomic(PacketPtr pkt, bool validateAccess=false);
     Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &_backdoor);
-    void recvFunctional(PacketPtr pkt);
+    void recvFunctional(PacketPtr pkt, bool trackReady=false);
     bool recvTimingReq(PacketPtr pkt, PortID recvPort, bool validateAccess=false);
     void recvRespRetry(PortID id);
 };